@@ -6,7 +6,7 @@
 // --- Include the model and its helpers ---
 #include "mnist_weights_int8.h" // Use the header file with int8 weights and quantization params
 #include <limits.h>             // Required for INT8_MIN (though not used in final code below)
-#include <math.h>               // Required for roundf if using standard lib, otherwise use custom one
+#include <math.h>               // Required for roundf
 
 // --- Screen and Drawing Definitions ---
 #define SCREEN_WIDTH 64 // Assuming 64x32 screen based on example
@@ -45,23 +45,6 @@ static float layer1_accumulators_float[L1_OUTPUT_SIZE];
 #define INPUT_SCALE (1.0f / 255.0f)
 #define LEAKY_RELU_ALPHA 0.01f
 
-// --- Custom roundf ---
-float roundf(float x) {
-    if (x >= 0) {
-        if (x - (int)x >= 0.5) {
-            return (int)x + 1;
-        } else {
-            return (int)x;
-        }
-    } else {
-        if ((int)x - x >= 0.5) {
-            return (int)x - 1;
-        } else {
-            return (int)x;
-        }
-    }
-}
-
 // --- Helper function to clear a rectangular area ---
 void clear_rect(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
     uint8_t ix, iy;
@@ -15,22 +15,6 @@ static float layer1_accumulators_float[L1_OUTPUT_SIZE];
 
 #define LEAKY_RELU_ALPHA 0.01f
 
-float roundf(float x) {
-    if (x >= 0) {
-        if (x - (int)x >= 0.5) {
-            return (int)x + 1;
-        } else {
-            return (int)x;
-        }
-    } else {
-        if ((int)x - x >= 0.5) {
-            return (int)x - 1;
-        } else {
-            return (int)x;
-        }
-    }
-}
-
 // Helper function for quantization
 static inline int8_t quantize_float_to_int8(float value, float scale, int32_t zero_point)
 {
@@ -0,0 +1,20 @@
+#include <compiled_printf.h>
+
+// The format strings below are parsed entirely at compile time; each call
+// compiles to a handful of bulk writes and typed conversions.
+
+int main() {
+  int score = 1234;
+  unsigned char lives = 3;
+  cprintf::print(CPRINTF_FORMAT("SCORE %06d LIVES %u\n"), score, lives);
+
+  char hud[16];
+  cprintf::snprint(hud, sizeof(hud), CPRINTF_FORMAT("X:%3d Y:%3d"), 17, -4);
+  cprintf::print(CPRINTF_FORMAT("%s|%#06x|%c\n"), hud, 0xbeefu, '!');
+
+#if __cplusplus >= 202002L
+  // C++20 allows passing the format directly as a template argument.
+  cprintf::print<"PI IS ABOUT %.3f\n">(3.14159f);
+#endif
+  return 0;
+}
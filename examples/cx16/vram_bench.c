@@ -0,0 +1,74 @@
+// llvm-mos-sdk cx16 bulk VRAM transfer benchmark
+//
+// Times the vram_* streaming routines against per-byte vpoke/vpeek, using the
+// x16emu cycle counter, and checks that they agree.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cx16.h>
+
+#define BUF_A 0x10000UL
+#define BUF_B 0x12000UL
+#define LEN 2048
+
+static unsigned char ram[LEN], back[LEN];
+
+static uint32_t cycles(void) { return EMULATOR.cycle_count; }
+
+static void report(const char *name, uint32_t slow, uint32_t fast) {
+  printf("%-16s vpoke %7lu  bulk %7lu cycles\n", name, (unsigned long)slow,
+         (unsigned long)fast);
+}
+
+int main(void) {
+  for (unsigned int i = 0; i < LEN; ++i)
+    ram[i] = (unsigned char)(i * 7);
+
+  uint32_t t = cycles();
+  for (unsigned int i = 0; i < LEN; ++i)
+    vpoke(ram[i], BUF_A + i);
+  uint32_t slow = cycles() - t;
+  t = cycles();
+  vram_copy_to(BUF_A, ram, LEN);
+  report("copy to", slow, cycles() - t);
+
+  t = cycles();
+  for (unsigned int i = 0; i < LEN; ++i)
+    back[i] = vpeek(BUF_A + i);
+  slow = cycles() - t;
+  memset(back, 0, LEN);
+  t = cycles();
+  vram_copy_from(back, BUF_A, LEN);
+  report("copy from", slow, cycles() - t);
+  printf("round trip %s\n", memcmp(ram, back, LEN) ? "bad" : "ok");
+
+  t = cycles();
+  for (unsigned int i = 0; i < LEN; ++i)
+    vpoke(vpeek(BUF_A + i), BUF_B + i);
+  slow = cycles() - t;
+  t = cycles();
+  vram_copy_vram2vram(BUF_B, BUF_A, LEN);
+  report("vram to vram", slow, cycles() - t);
+  vram_copy_from(back, BUF_B, LEN);
+  printf("vram copy %s\n", memcmp(ram, back, LEN) ? "bad" : "ok");
+
+  t = cycles();
+  for (unsigned int i = 0; i < LEN; ++i)
+    vpoke(0x11, BUF_B + i);
+  slow = cycles() - t;
+  t = cycles();
+  vram_fill(BUF_B, 0x11, LEN);
+  report("fill", slow, cycles() - t);
+
+  // A 16-pixel column of a 320-pixel wide 8bpp bitmap.
+  t = cycles();
+  for (unsigned int i = 0; i < 16; ++i)
+    vpoke(ram[i], BUF_A + i * 320UL);
+  slow = cycles() - t;
+  t = cycles();
+  vram_copy_to_stride(BUF_A, ram, 16, VERA_INC_320);
+  report("column", slow, cycles() - t);
+  return 0;
+}
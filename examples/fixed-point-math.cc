@@ -0,0 +1,42 @@
+#undef NDEBUG
+#include <assert.h>
+#include <fixed_point_math.h>
+
+// This file is an example of the math functions in fixed_point_math.h. They
+// work directly on the raw fixed point values, so none of these calls pull in
+// floating point at runtime; the literals below are converted at compile time.
+
+int main() {
+  using namespace fixedpoint_literals;
+
+  // Angles are 8-bit binary angles: 256 units make a full turn, so a quarter
+  // turn is 64 and uint8_t arithmetic wraps around the circle for free.
+  assert(fixedpoint::sin<f8_8>(64) == 1);
+  assert(fixedpoint::cos<f8_8>(128) == -1);
+  assert(fixedpoint::sin<f8_8>(192) == -1);
+
+  // The same functions work for any 16- or 32-bit format. 4.12 gives more
+  // precision for values that stay small, like unit vectors.
+  f4_12 s45 = fixedpoint::sin<f4_12>(32);
+  assert(s45 > 0.7069_4_12 && s45 < 0.7073_4_12);
+
+  // atan2 returns a binary angle too, so its result feeds straight back into
+  // sin and cos.
+  uint8_t heading = fixedpoint::atan2(1.0_8_8, 1.0_8_8);
+  assert(heading == 32);
+  assert(fixedpoint::atan2(-2.0_8_8, 0.0_8_8) == 192);
+
+  // Square roots and reciprocals round to the nearest representable value.
+  f16_16 root2 = fixedpoint::sqrt(2.0_16_16);
+  assert(root2 > 1.41420_16_16 && root2 < 1.41425_16_16);
+  assert(fixedpoint::reciprocal(4.0_8_8) == 0.25_8_8);
+  f4_12 third = fixedpoint::reciprocal(3.0_4_12);
+  assert(third > 0.3330_4_12 && third < 0.3336_4_12);
+
+  // Linear interpolation takes a fixed point fraction, or an 8-bit one in
+  // 1/256ths for the cheapest possible blend.
+  assert(fixedpoint::lerp(1.0_8_8, 3.0_8_8, 0.5_8_8) == 2);
+  assert(fixedpoint::lerp8(1.0_8_8, 3.0_8_8, 128) == 2);
+
+  return 0;
+}
@@ -58,5 +58,11 @@ int main() {
   // Since its unsigned, it will be treated as a positive value instead
   assert ( unsigned_number > 200 );
 
+  // Multiplication and division keep the binary point in place, so they
+  // behave like the real numbers they represent.
+  auto product = -1.5_8_8 * 2.25_8_8;
+  assert( product == -3.375_8_8 );
+  assert( product / 2.25_8_8 == -1.5_8_8 );
+
   return 0;
 }
@@ -11,6 +11,7 @@ using namespace mega65::dma;
 constexpr uint32_t SCREEN_ADDR = 0x0800; // Screen area
 constexpr uint16_t COUNT = 4;            // Bytes to fill
 constexpr uint8_t CHAR = 41;             // Char symbol to print
+constexpr uint32_t COLOR_ADDR = 0xff80000; // Colour RAM
 
 int main(void) {
   {
@@ -23,4 +24,12 @@ int main(void) {
     const auto dma = make_dma_copy(SCREEN_ADDR, SCREEN_ADDR + 80, COUNT);
     trigger_dma(dma);
   }
+  {
+    // copy both lines to the third and fourth, and colour all four lines,
+    // in one chained DMA job built at compile time
+    static constexpr auto chain = make_dma_chain(
+        make_dma_copy(SCREEN_ADDR, SCREEN_ADDR + 160, 160),
+        make_dma_fill(COLOR_ADDR, COLOR_YELLOW, 320));
+    trigger_dma(chain);
+  }
 }
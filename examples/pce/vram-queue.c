@@ -0,0 +1,59 @@
+/**
+ * vram-queue
+ *
+ * To the extent possible under law, the person who associated CC0 with
+ * vram-queue has waived all copyright and related or neighboring rights
+ * to vram-queue.
+ *
+ * You should have received a copy of the CC0 legalcode along with this
+ * work.  If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+ */
+
+#include <pce.h>
+
+#define SATB_VRAM 0x7F00
+
+static vdc_sprite_t sprites[64];
+static volatile uint8_t frame;
+
+__attribute__((interrupt)) void irq_vdc(void) {
+  // This also acknowledges the interrupt.
+  uint8_t status = *IO_VDC_STATUS;
+
+  if (status & VDC_FLAG_VBLANK) {
+    pce_vdc_queue_drain();
+    frame++;
+  }
+}
+
+int main(void) {
+  pce_vdc_set_resolution(256, 240, 0);
+  pce_vdc_set_copy_word();
+  pce_vdc_queue_set_budget(2048);
+
+  pce_vdc_irq_vblank_enable();
+  pce_irq_enable(IRQ_VDC);
+  pce_cpu_irq_enable();
+
+  while (1) {
+    uint8_t now = frame;
+
+    // Scroll a stripe through the first rows of the tile map, and move a
+    // sprite; all of it lands in VRAM during the next VBlank.
+    pce_vdc_queue_fill(0, 0, 64);
+    pce_vdc_queue_fill(now & 63, 0x1100, 1);
+    sprites[0].x = 32 + now;
+    sprites[0].y = 128;
+    pce_vdc_queue_copy(SATB_VRAM, sprites, sizeof(sprites));
+    pce_vdc_queue_satb(SATB_VRAM);
+
+    // Show the bytes uploaded last frame as the background color.
+    vdc_queue_stats_t stats;
+    pce_vdc_queue_get_stats(&stats);
+    *IO_VCE_COLOR_INDEX = 0x100;
+    *IO_VCE_COLOR_DATA = stats.bytes >> 3;
+
+    while (frame == now)
+      ;
+  }
+}
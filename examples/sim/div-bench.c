@@ -0,0 +1,58 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measures the simulator cycle cost of division and modulo across operand
+// widths and divisor sizes. Run with `mos-sim div-bench`.
+
+#define ITERATIONS 64
+
+static volatile uint16_t n16, d16;
+static volatile uint32_t n32, d32;
+static volatile uint64_t n64, d64;
+static volatile uint16_t r16;
+static volatile uint32_t r32;
+static volatile uint64_t r64;
+
+static unsigned long overhead;
+
+#define BENCH(name, n, nv, d, dv, stmt)                                        \
+  do {                                                                         \
+    n = nv;                                                                    \
+    d = dv;                                                                    \
+    reset_clock();                                                             \
+    for (char i = 0; i < ITERATIONS; ++i)                                      \
+      stmt;                                                                    \
+    unsigned long cycles = clock() / ITERATIONS - overhead;                    \
+    printf("%-24s %8lu cycles\n", name, cycles);                               \
+  } while (0)
+
+int main(void) {
+  reset_clock();
+  for (char i = 0; i < ITERATIONS; ++i)
+    r16 = n16;
+  overhead = clock() / ITERATIONS;
+
+  BENCH("u16 / 10", n16, 54321, d16, 10, r16 = n16 / d16);
+  BENCH("u16 % 10", n16, 54321, d16, 10, r16 = n16 % d16);
+  BENCH("u16 / 200 (small n)", n16, 1234, d16, 200, r16 = n16 / d16);
+  BENCH("u16 / 1000", n16, 54321, d16, 1000, r16 = n16 / d16);
+  BENCH("u16 / 40000", n16, 54321, d16, 40000, r16 = n16 / d16);
+  BENCH("u32 / 10", n32, 3141592653ul, d32, 10, r32 = n32 / d32);
+  BENCH("u32 % 10", n32, 3141592653ul, d32, 10, r32 = n32 % d32);
+  BENCH("u32 / 1000 (small n)", n32, 123456ul, d32, 1000, r32 = n32 / d32);
+  BENCH("u32 / 60000", n32, 3141592653ul, d32, 60000, r32 = n32 / d32);
+  BENCH("u32 / 0x12345678", n32, 3141592653ul, d32, 0x12345678ul,
+        r32 = n32 / d32);
+  BENCH("u64 / 10", n64, 1700000000123456ull, d64, 10, r64 = n64 / d64);
+  BENCH("u64 % 10", n64, 1700000000123456ull, d64, 10, r64 = n64 % d64);
+  BENCH("u64 / 1000 (small n)", n64, 3141592653ull, d64, 1000,
+        r64 = n64 / d64);
+  BENCH("u64 / 60000 (64/16)", n64, 1700000000123456ull, d64, 60000,
+        r64 = n64 / d64);
+  BENCH("u64 / 1000000 (64/32)", n64, 1700000000123456ull, d64, 1000000,
+        r64 = n64 / d64);
+  BENCH("u64 / 0x123456789a", n64, 1700000000123456ull, d64,
+        0x123456789aull, r64 = n64 / d64);
+  return 0;
+}
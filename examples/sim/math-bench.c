@@ -0,0 +1,285 @@
+#include <fixmath.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Checks the float and fixed-point math routines against reference values and
+// measures their simulator cycle cost. Run with `mos-sim math-bench`; the exit
+// status is the number of results out of tolerance.
+
+struct f1_case {
+  float x, want;
+};
+struct f2_case {
+  float y, x, want;
+};
+struct fix8_case {
+  fix8_t x, want;
+};
+struct fix8_2_case {
+  fix8_t y, x, want;
+};
+struct fix16_case {
+  fix16_t x, want;
+};
+struct fix16_2_case {
+  fix16_t y, x, want;
+};
+
+static const struct f1_case sqrtf_cases[] = {
+    {0.0f, 0.0f},
+    {1e-30f, 1e-15f},
+    {0.25f, 0.5f},
+    {2.0f, 1.41421354f},
+    {3.0f, 1.73205078f},
+    {10.0f, 3.1622777f},
+    {12345.6777f, 111.111107f},
+    {3.39999995e+38f, 1.84390893e+19f},
+};
+static const struct f1_case sinf_cases[] = {
+    {0.0f, 0.0f},
+    {0.00100000005f, 0.000999999931f},
+    {0.5f, 0.47942555f},
+    {1.0f, 0.841470957f},
+    {2.5f, 0.598472118f},
+    {-3.0f, -0.141120002f},
+    {6.0f, -0.279415488f},
+    {100.0f, -0.506365657f},
+};
+static const struct f1_case cosf_cases[] = {
+    {0.0f, 1.0f},
+    {0.00100000005f, 0.999999523f},
+    {0.5f, 0.87758255f},
+    {1.0f, 0.540302277f},
+    {2.5f, -0.801143587f},
+    {-3.0f, -0.989992499f},
+    {6.0f, 0.960170269f},
+    {100.0f, 0.862318873f},
+};
+static const struct f1_case expf_cases[] = {
+    {0.0f, 1.0f},
+    {-9.99999975e-05f, 0.999899983f},
+    {0.5f, 1.64872122f},
+    {1.0f, 2.71828175f},
+    {-2.5f, 0.0820849985f},
+    {10.0f, 22026.4648f},
+    {-50.0f, 1.92874989e-22f},
+    {88.0f, 1.65163627e+38f},
+};
+static const struct f1_case logf_cases[] = {
+    {1e-30f, -69.0775528f},
+    {0.00100000005f, -6.90775537f},
+    {0.5f, -0.693147182f},
+    {0.999000013f, -0.00100048748f},
+    {1.0f, 0.0f},
+    {1.00100005f, 0.000999546959f},
+    {10.0f, 2.30258512f},
+    {1.00000002e+30f, 69.0775528f},
+};
+static const struct f1_case floorf_cases[] = {
+    {0.0f, 0.0f},
+    {0.5f, 0.0f},
+    {-0.5f, -1.0f},
+    {1.5f, 1.0f},
+    {-1.5f, -2.0f},
+    {123.75f, 123.0f},
+    {-123.75f, -124.0f},
+    {1e+10f, 1e+10f},
+};
+static const struct f1_case roundf_cases[] = {
+    {0.0f, 0.0f},
+    {0.49000001f, 0.0f},
+    {0.5f, 1.0f},
+    {-0.5f, -1.0f},
+    {1.5f, 2.0f},
+    {-2.5f, -3.0f},
+    {123.25f, 123.0f},
+    {-1e+10f, -1e+10f},
+};
+static const struct f1_case fabsf_cases[] = {
+    {0.0f, 0.0f},
+    {-0.0f, 0.0f},
+    {1.5f, 1.5f},
+    {-1.5f, 1.5f},
+    {-1.00000002e+30f, 1.00000002e+30f},
+    {1e-30f, 1e-30f},
+    {-123.0f, 123.0f},
+    {42.0f, 42.0f},
+};
+static const struct f2_case atan2f_cases[] = {
+    {1.0f, 1.0f, 0.785398185f},
+    {1.0f, -1.0f, 2.3561945f},
+    {-1.0f, -1.0f, -2.3561945f},
+    {0.5f, 2.0f, 0.244978666f},
+    {3.0f, -0.25f, 1.65393758f},
+    {-7.0f, 0.00100000005f, -1.57065344f},
+    {0.0f, -1.0f, 3.14159274f},
+    {100.0f, 1.0f, 1.56079662f},
+};
+static const struct fix8_case fix8_sqrt_cases[] = {
+    {64, 128},
+    {512, 362},
+    {768, 443},
+    {25600, 2560},
+    {32640, 2891},
+};
+static const struct fix8_case fix8_sin_cases[] = {
+    {0, 0},
+    {128, 123},
+    {384, 255},
+    {-768, -36},
+    {25600, -130},
+};
+static const struct fix8_case fix8_cos_cases[] = {
+    {0, 256},
+    {128, 225},
+    {384, 18},
+    {-768, -253},
+    {25600, 221},
+};
+static const struct fix8_case fix8_exp_cases[] = {
+    {0, 256},
+    {-256, 94},
+    {256, 696},
+    {640, 3119},
+    {-1280, 2},
+};
+static const struct fix8_case fix8_log_cases[] = {
+    {128, -177},
+    {256, 0},
+    {512, 177},
+    {2560, 589},
+    {25600, 1179},
+};
+static const struct fix8_2_case fix8_atan2_cases[] = {
+    {256, 256, 201},
+    {256, -256, 603},
+    {-512, -256, -521},
+    {128, 512, 63},
+    {0, -256, 804},
+};
+static const struct fix16_case fix16_sqrt_cases[] = {
+    {16384, 32768},
+    {131072, 92682},
+    {196608, 113512},
+    {65536000, 2072430},
+    {1966080000, 11351168},
+};
+static const struct fix16_case fix16_sin_cases[] = {
+    {0, 0},
+    {32768, 31420},
+    {98304, 65372},
+    {-196608, -9248},
+    {65536000, 54190},
+};
+static const struct fix16_case fix16_cos_cases[] = {
+    {0, 65536},
+    {32768, 57513},
+    {98304, 4636},
+    {-196608, -64880},
+    {65536000, 36856},
+};
+static const struct fix16_case fix16_exp_cases[] = {
+    {0, 65536},
+    {-65536, 24109},
+    {65536, 178145},
+    {163840, 798392},
+    {655360, 1443526462},
+};
+static const struct fix16_case fix16_log_cases[] = {
+    {66, -452244},
+    {65536, 0},
+    {131072, 45426},
+    {655360, 150902},
+    {1966080000, 675608},
+};
+static const struct fix16_2_case fix16_atan2_cases[] = {
+    {65536, 65536, 51472},
+    {65536, -65536, 154416},
+    {-131072, -65536, -133329},
+    {32768, 131072, 16055},
+    {0, -65536, 205887},
+};
+
+#define COUNT(a) (sizeof(a) / sizeof(a[0]))
+
+static unsigned failures;
+
+static void report(const char *name, unsigned i, char ok) {
+  if (ok)
+    return;
+  printf("%s: case %u out of tolerance\n", name, i);
+  ++failures;
+}
+
+// Floats must be within 4 ULPs.
+static char float_ok(float got, float want) {
+  return fabsf(got - want) <= fabsf(want) * 0x1p-21f;
+}
+
+// Fixed-point results must be within a few units in the last place.
+static char fix_ok(int32_t got, int32_t want, int32_t units) {
+  int32_t err = got - want;
+  if (err < 0)
+    err = -err;
+  return err <= units;
+}
+
+static volatile float float_sink;
+static volatile int32_t fix_sink;
+
+#define BENCH(name, cases, call, ok)                                            \
+  do {                                                                         \
+    reset_clock();                                                             \
+    for (unsigned i = 0; i < COUNT(cases); ++i)                                \
+      call;                                                                    \
+    unsigned long cycles = clock() / COUNT(cases);                             \
+    printf("%-12s %8lu cycles\n", name, cycles);                               \
+    for (unsigned i = 0; i < COUNT(cases); ++i)                                \
+      report(name, i, ok);                                                     \
+  } while (0)
+
+#define BENCH_F1(f)                                                            \
+  BENCH(#f, f##_cases, float_sink = f(f##_cases[i].x),                        \
+        float_ok(f(f##_cases[i].x), f##_cases[i].want))
+
+#define BENCH_FIX(f, units)                                                    \
+  BENCH(#f, f##_cases, fix_sink = f(f##_cases[i].x),                          \
+        fix_ok(f(f##_cases[i].x), f##_cases[i].want, units))
+
+#define BENCH_FIX2(f, units)                                                   \
+  BENCH(#f, f##_cases, fix_sink = f(f##_cases[i].y, f##_cases[i].x),          \
+        fix_ok(f(f##_cases[i].y, f##_cases[i].x), f##_cases[i].want, units))
+
+int main(void) {
+  BENCH_F1(fabsf);
+  BENCH_F1(floorf);
+  BENCH_F1(roundf);
+  BENCH_F1(sqrtf);
+  BENCH_F1(sinf);
+  BENCH_F1(cosf);
+  BENCH("atan2f", atan2f_cases,
+        float_sink = atan2f(atan2f_cases[i].y, atan2f_cases[i].x),
+        float_ok(atan2f(atan2f_cases[i].y, atan2f_cases[i].x),
+                 atan2f_cases[i].want));
+  BENCH_F1(expf);
+  BENCH_F1(logf);
+
+  BENCH_FIX(fix8_sqrt, 1);
+  BENCH_FIX(fix8_sin, 1);
+  BENCH_FIX(fix8_cos, 1);
+  BENCH_FIX2(fix8_atan2, 1);
+  BENCH_FIX(fix8_exp, 1);
+  BENCH_FIX(fix8_log, 1);
+
+  BENCH_FIX(fix16_sqrt, 4);
+  BENCH_FIX(fix16_sin, 4);
+  BENCH_FIX(fix16_cos, 4);
+  BENCH_FIX2(fix16_atan2, 4);
+  BENCH_FIX(fix16_exp, 4);
+  BENCH_FIX(fix16_log, 4);
+
+  printf("%u failures\n", failures);
+  return failures;
+}
@@ -0,0 +1,47 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measures the simulator cycle cost of multiplication at each width. Built
+// twice: mul-bench uses the default libcalls, and mul-bench-fastmul links the
+// quarter-square tables from -lfastmul. Run with `mos-sim mul-bench`.
+
+#define ITERATIONS 64
+
+static volatile uint8_t a8 = 173, b8 = 219;
+static volatile uint16_t a16 = 48611, b16 = 40503;
+static volatile uint32_t a32 = 3141592653ul, b32 = 2718281828ul;
+static volatile uint64_t a64 = 0x0123456789abcdefull,
+                         b64 = 0xfedcba9876543210ull;
+static volatile uint8_t r8;
+static volatile uint16_t r16;
+static volatile uint32_t r32;
+static volatile uint64_t r64;
+
+static unsigned long overhead;
+
+#define BENCH(name, stmt)                                                      \
+  do {                                                                         \
+    reset_clock();                                                             \
+    for (char i = 0; i < ITERATIONS; ++i)                                      \
+      stmt;                                                                    \
+    unsigned long cycles = clock() / ITERATIONS - overhead;                    \
+    printf("%-14s %8lu cycles/multiply\n", name, cycles);                      \
+  } while (0)
+
+int main(void) {
+  reset_clock();
+  for (char i = 0; i < ITERATIONS; ++i)
+    r8 = a8;
+  overhead = clock() / ITERATIONS;
+
+  BENCH("8x8->8", r8 = a8 * b8);
+  BENCH("8x8->16", r16 = (uint16_t)a8 * b8);
+  BENCH("16x16->16", r16 = a16 * b16);
+  BENCH("16x16->32", r32 = (uint32_t)a16 * b16);
+  BENCH("32x32->32", r32 = a32 * b32);
+  BENCH("32x32->64", r64 = (uint64_t)a32 * b32);
+  BENCH("64x16->64", r64 = a64 * b16);
+  BENCH("64x64->64", r64 = a64 * b64);
+  return 0;
+}
@@ -0,0 +1,34 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measures the simulator cycle cost of parsing an integer with each of the
+// string-to-integer entry points. Run with `mos-sim parse-bench`.
+
+#define ITERATIONS 64
+
+static volatile long sink;
+
+#define BENCH(name, expr)                                                      \
+  do {                                                                         \
+    reset_clock();                                                             \
+    for (char i = 0; i < ITERATIONS; ++i)                                      \
+      sink = (expr);                                                           \
+    printf("%-28s %8lu cycles/parse\n", name, clock() / ITERATIONS);           \
+  } while (0)
+
+int main(void) {
+  int i;
+  unsigned char c;
+  long l;
+
+  BENCH("_strtouc(\"200\", 10)", _strtouc("200", NULL, 10));
+  BENCH("_strtoi(\"-12345\", 10)", _strtoi("-12345", NULL, 10));
+  BENCH("_strtoui(\"beef\", 16)", _strtoui("beef", NULL, 16));
+  BENCH("strtol(\"-1234567\", 10)", strtol("-1234567", NULL, 10));
+  BENCH("atoi(\"-12345\")", atoi("-12345"));
+  BENCH("sscanf(\"%d\", \"-12345\")", sscanf("-12345", "%d", &i));
+  BENCH("sscanf(\"%hhu\", \"200\")", sscanf("200", "%hhu", &c));
+  BENCH("sscanf(\"%x\", \"beef\")", sscanf("beef", "%x", &i));
+  BENCH("sscanf(\"%ld\", \"-1234567\")", sscanf("-1234567", "%ld", &l));
+  return 0;
+}
@@ -0,0 +1,39 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Measures the simulator cycle cost of a single integer conversion for each
+// argument width. Run with `mos-sim printf-bench`.
+
+#define ITERATIONS 64
+
+static char buf[32];
+
+static unsigned long overhead;
+
+#define BENCH(name, format, value)                                             \
+  do {                                                                         \
+    reset_clock();                                                             \
+    for (char i = 0; i < ITERATIONS; ++i)                                      \
+      snprintf(buf, sizeof(buf), format, value);                               \
+    unsigned long cycles = clock() / ITERATIONS - overhead;                    \
+    printf("%-8s %-6s %8lu cycles/conversion\n", name, format, cycles);        \
+  } while (0)
+
+int main(void) {
+  reset_clock();
+  for (char i = 0; i < ITERATIONS; ++i)
+    snprintf(buf, sizeof(buf), "");
+  overhead = clock() / ITERATIONS;
+
+  BENCH("8-bit", "%hhu", 255);
+  BENCH("16-bit", "%u", 65535u);
+  BENCH("16-bit", "%d", -12345);
+  BENCH("32-bit", "%lu", 4294967295ul);
+  BENCH("32-bit", "%ld", -1234567l);
+  BENCH("64-bit", "%llu", 18446744073709551615ull);
+  BENCH("16-bit", "%x", 0xbeefu);
+  BENCH("32-bit", "%lX", 0xdeadbeeful);
+  BENCH("16-bit", "%o", 0777u);
+  return 0;
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <radix_sort.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Compares std::sort, std::stable_sort and std::lower_bound against qsort()
+// and bsearch() on a typical per-frame workload: ordering 200 sprite Y
+// positions. The radix sort from radix_sort.h, which leaves the keys in place
+// and produces an index permutation, is timed on the same keys. Run with
+// `mos-sim sort-bench`.
+
+#define COUNT 200
+
+struct Sprite {
+  uint8_t y;
+  uint8_t id;
+};
+
+static uint8_t ys[COUNT], work8[COUNT];
+static int ints[COUNT], work16[COUNT];
+static Sprite sprites[COUNT], worksp[COUNT];
+static uint8_t perm[COUNT];
+
+static int cmp_u8(const void *a, const void *b) {
+  return *(const uint8_t *)a - *(const uint8_t *)b;
+}
+static int cmp_int(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return x < y ? -1 : x > y;
+}
+static int cmp_sprite(const void *a, const void *b) {
+  return ((const Sprite *)a)->y - ((const Sprite *)b)->y;
+}
+
+template <class T> static bool sorted(const T *a) {
+  for (int i = 1; i < COUNT; ++i)
+    if (a[i] < a[i - 1])
+      return false;
+  return true;
+}
+
+template <class T> static void load(T *dst, const T *src) {
+  for (int i = 0; i < COUNT; ++i)
+    dst[i] = src[i];
+}
+
+static void report(const char *name, unsigned long slow, unsigned long fast,
+                   bool ok) {
+  printf("%-18s qsort %7lu  std %7lu cycles %s\n", name, slow, fast,
+         ok ? "" : "BAD");
+}
+
+int main(void) {
+  uint16_t seed = 1;
+  for (int i = 0; i < COUNT; ++i) {
+    seed = seed * 25173 + 13849;
+    ys[i] = seed >> 8;
+    ints[i] = seed;
+    sprites[i] = {uint8_t(seed >> 8), uint8_t(i)};
+  }
+
+  load(work8, ys);
+  reset_clock();
+  qsort(work8, COUNT, 1, cmp_u8);
+  unsigned long slow = clock();
+  load(work8, ys);
+  reset_clock();
+  std::sort(work8, work8 + COUNT);
+  report("sort u8", slow, clock(), sorted(work8));
+
+  reset_clock();
+  radix_sort_u8(ys, COUNT, perm);
+  unsigned long radix = clock();
+  bool ok = true;
+  for (int i = 1; i < COUNT; ++i)
+    ok &= ys[perm[i - 1]] <= ys[perm[i]];
+  printf("%-18s radix %7lu cycles %s\n", "perm u8", radix, ok ? "" : "BAD");
+
+  load(work16, ints);
+  reset_clock();
+  qsort(work16, COUNT, sizeof(int), cmp_int);
+  slow = clock();
+  load(work16, ints);
+  reset_clock();
+  std::sort(work16, work16 + COUNT);
+  report("sort int", slow, clock(), sorted(work16));
+
+  // Nearly sorted, as sprite order is from one frame to the next.
+  for (int i = 0; i < COUNT; i += 10)
+    work8[i] ^= 7;
+  load(ys, work8);
+  reset_clock();
+  qsort(work8, COUNT, 1, cmp_u8);
+  slow = clock();
+  load(work8, ys);
+  reset_clock();
+  std::sort(work8, work8 + COUNT);
+  report("sort nearly", slow, clock(), sorted(work8));
+
+  auto by_y = [](const Sprite &a, const Sprite &b) { return a.y < b.y; };
+  load(worksp, sprites);
+  reset_clock();
+  qsort(worksp, COUNT, sizeof(Sprite), cmp_sprite);
+  slow = clock();
+  load(worksp, sprites);
+  reset_clock();
+  std::stable_sort(worksp, worksp + COUNT, by_y);
+  unsigned long fast = clock();
+  ok = true;
+  for (int i = 1; i < COUNT; ++i)
+    ok &= worksp[i - 1].y < worksp[i].y ||
+          (worksp[i - 1].y == worksp[i].y && worksp[i - 1].id < worksp[i].id);
+  report("stable sprites", slow, fast, ok);
+
+  reset_clock();
+  for (int i = 0; i < COUNT; ++i)
+    bsearch(&ints[i], work16, COUNT, sizeof(int), cmp_int);
+  slow = clock();
+  ok = true;
+  reset_clock();
+  for (int i = 0; i < COUNT; ++i)
+    ok &= std::binary_search(work16, work16 + COUNT, ints[i]);
+  report("search x200", slow, clock(), ok);
+  return 0;
+}
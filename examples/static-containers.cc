@@ -0,0 +1,60 @@
+#include <cstdio>
+#include <static_containers.h>
+
+// This file provides an exposition of the fixed-capacity containers in
+// static_containers.h. None of them allocate; a container is exactly as large
+// as its elements plus an 8-bit size, so statics cost nothing at startup.
+
+using namespace static_containers;
+
+struct Enemy {
+  char x, y;
+};
+
+int main() {
+  // A vector of up to 16 ints. Pushing past the capacity fails instead of
+  // growing.
+  static static_vector<int, 16> Scores;
+  for (int I = 0; I < 20; ++I)
+    if (!Scores.push_back(I * 100))
+      printf("full at %d\n", I);
+  // swap_remove() is O(1) when the order doesn't matter.
+  Scores.swap_remove(0);
+  printf("%d %d\n", Scores.front(), Scores.size());
+
+  // Passing true as the last parameter stores the elements as a struct of
+  // arrays (see soa.h), so each field is reachable with absolute,X
+  // addressing.
+  static static_vector<Enemy, 32, true> Enemies;
+  Enemies.push_back({10, 20});
+  Enemies.push_back({30, 40});
+  for (auto E : Enemies)
+    printf("enemy %d,%d\n", E->x, E->y);
+
+  // A 256-entry ring buffer wraps its 8-bit indices for free.
+  static ring_buffer<char, 256> Keys;
+  Keys.push('a');
+  Keys.push('b');
+  char C;
+  while (Keys.try_pop(C))
+    printf("%c", C);
+  printf("\n");
+
+  // A sorted map; lookups are a binary search over the keys only.
+  static flat_map<unsigned char, int, 32> Tiles;
+  Tiles.insert_or_assign(7, 700);
+  Tiles.insert_or_assign(3, 300);
+  if (int *V = Tiles.get(7))
+    printf("tile 7: %d\n", *V);
+  printf("contains 4: %d\n", Tiles.contains(4));
+
+  static bitset<200> Visited;
+  Visited.set(42).set(150);
+  printf("%d visited, first %d\n", Visited.count(), Visited.find_first());
+
+  // Strings truncate rather than overflow.
+  small_string<10> Name = "llvm";
+  Name += "-mos-sdk";
+  printf("%s %d\n", Name.c_str(), Name.size());
+  return 0;
+}
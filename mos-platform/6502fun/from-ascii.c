@@ -0,0 +1,29 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#include <stdio.h>
+
+#define PUT_CHAR 0xfff1
+
+__attribute__((always_inline, weak)) int
+__from_ascii(char c, void *ctx, int (*write)(char c, void *ctx)) {
+  if (__builtin_expect(c == '\n', 0))
+    if (write('\r', ctx) == EOF)
+      return EOF;
+  return write(c, ctx);
+}
+
+// Streams a run straight to the output register, applying the same newline
+// translation as __from_ascii above. It lives here so that it leaves the link
+// along with __from_ascii when a program overrides that.
+void __putchars(const char *s, size_t n) {
+  volatile char *address = (volatile char *)PUT_CHAR;
+  for (; n; --n) {
+    char c = *s++;
+    if (__builtin_expect(c == '\n', 0))
+      *address = '\r';
+    *address = c;
+  }
+}
@@ -0,0 +1,27 @@
+; Copyright 2024 LLVM-MOS Project
+; Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+; See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+; information.
+
+;
+; Block transfer hooks for read() and write().
+;
+; __cbm_macptr: Read up to A bytes (0 = as many as the device likes, up to
+;               512) from the input channel to X/Y. Returns the count read in
+;               X/Y, or carry set if block reads are unsupported.
+; __cbm_mciout: Write up to A bytes from X/Y to the output channel. Returns
+;               the count written in X/Y, or carry set if block writes are
+;               unsupported.
+;
+; Carry clear on entry advances through memory. Kernals with MACPTR/MCIOUT
+; override these; the defaults always report no support, so read() and write()
+; fall back to BASIN/BSOUT.
+;
+
+.section .text.__cbm_macptr,"ax",@progbits
+.global __cbm_macptr
+.global __cbm_mciout
+__cbm_macptr:
+__cbm_mciout:
+	sec
+	rts
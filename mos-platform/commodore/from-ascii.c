@@ -0,0 +1,32 @@
+#include <__internal.h>
+#include <stdio.h>
+
+#define __CBM__
+#include <cbm.h>
+
+// The default character conversion used with the screen requires the screen to
+// be in shifted PETSCII, so establish it before it is used. This is done in
+// assembly to avoid pulling in init_array machinery for small programs.
+asm(".section .init.250,\"ax\",@progbits\n"
+    "shift:\n"
+    "  lda #0x0e\n"
+    "  jsr __CHROUT\n");
+
+// ASCII to shifted PETSCII, on unsigned character values. Letters swap case;
+// newline and backspace become carriage return and CURSOR LEFT.
+#define FROM_ASCII(c)                                                          \
+  ((c) == '\n'                ? '\r'                                           \
+   : (c) == '\b'              ? 0x9d                                           \
+   : 'a' <= (c) && (c) <= 'z' ? (c) & ~0x20                                    \
+   : 'A' <= (c) && (c) <= 'Z' ? (c) | 0x80                                     \
+                              : (c))
+
+// The table shares an object file with the callback it mirrors, so a program
+// that overrides __from_ascii leaves it out of the link as well.
+__attribute__((weak)) const char __from_ascii_table[256] = {
+    _CHAR_TABLE(FROM_ASCII)};
+
+__attribute__((always_inline, weak)) int
+__from_ascii(char c, void *ctx, int (*write)(char c, void *ctx)) {
+  return write(FROM_ASCII((unsigned char)c), ctx);
+}
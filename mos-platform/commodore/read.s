@@ -66,9 +66,92 @@ read:
 ; Valid lfn. Make it the input file
 
         jsr     CHKIN
-        bcc     5f              ; Branch if ok
+        bcc     .Lblock         ; Branch if ok
         jmp     __mappederrno   ; Store into __oserror, map to errno, return -1
 
+; Read whole blocks through MACPTR while the kernal and device support it.
+; Only disk units can do block transfers; the keyboard also needs its CR echo.
+
+.Lblock:
+        lda     unit
+        cmp     #FIRST_DRIVE
+        bcc     5f              ; Not a disk unit
+
+        ldx     __rc4
+        dex
+        stx     __rc8
+        ldx     __rc5
+        dex
+        stx     __rc9           ; Undo the count bias from rwcommon
+
+.Lblockloop:
+        ldx     __rc9
+        cpx     #2
+        lda     #0              ; 512 or more left: let the device send 512
+        bcs     .Lmacptr
+        lda     #$FF            ; 256 to 511 left: ask for 255
+        cpx     #1
+        beq     .Lmacptr
+        lda     __rc8           ; Less than 256 left: ask for all of it
+        beq     .Lbytewise      ; Nothing left; let the byte loop finish up
+
+.Lmacptr:
+        ldx     __rc2
+        ldy     __rc3
+        clc                     ; Advance through the buffer
+        jsr     __cbm_macptr
+        bcs     .Lbytewise      ; No block transfers; fall back to BASIN
+
+        stx     __rc10
+        sty     __rc13          ; Bytes read
+
+        txa
+        clc
+        adc     __rc2
+        sta     __rc2
+        tya
+        adc     __rc3
+        sta     __rc3           ; buf += n;
+
+        txa
+        clc
+        adc     __rc6
+        sta     __rc6
+        tya
+        adc     __rc7
+        sta     __rc7           ; Increment the byte count
+
+        sec
+        lda     __rc8
+        sbc     __rc10
+        sta     __rc8
+        lda     __rc9
+        sbc     __rc13
+        sta     __rc9           ; Decrement the count
+
+        jsr     READST          ; Read the IEEE status
+        sta     __rc12
+        and     #%10111111      ; Check anything but the EOI bit
+        beq     1f
+        jmp     devnotpresent   ; Assume device not present
+
+1:      lda     __rc12
+        and     #%01000000      ; Check for EOI
+        bne     6f              ; Jump if end of file reached
+
+        lda     __rc10
+        ora     __rc13
+        bne     .Lblockloop     ; Keep going while the device makes progress
+
+.Lbytewise:
+        ldx     __rc8
+        inx
+        stx     __rc4
+        ldx     __rc9
+        inx
+        stx     __rc5           ; Restore the count bias for the byte loop
+        jmp     5f
+
 ; Read the next byte
 
 1:      jsr     BASIN
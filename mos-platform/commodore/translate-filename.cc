@@ -3,12 +3,17 @@
 extern "C" const char *_translate_filename(const char *filename) {
   static char buf[36];
   char *bptr = buf;
-  for (const char *s = filename; *s; ++s)
-    __from_ascii(*s, &bptr, [](char c, void *ctx) {
-      char *&bptr = *(char **)ctx;
-      *bptr++ = c;
-      return 0;
-    });
+  if (__from_ascii_table) {
+    for (const char *s = filename; *s; ++s)
+      *bptr++ = __from_ascii_table[(unsigned char)*s];
+  } else {
+    for (const char *s = filename; *s; ++s)
+      __from_ascii(*s, &bptr, [](char c, void *ctx) {
+        char *&bptr = *(char **)ctx;
+        *bptr++ = c;
+        return 0;
+      });
+  }
   *bptr = '\0';
   return buf;
 }
@@ -54,13 +54,95 @@ write:
         and     #LFN_WRITE      ; File open for writing?
         beq     invalidfd
 
+; Remember the device number.
+
+        ldy     unittab-LFN_OFFS,x
+        sty     __rc10
+
 ; Valid lfn. Make it the output file
 
         jsr     CKOUT
-        bcc     3f
+        bcc     .Lblock
 .Lerror:
         jmp     __mappederrno   ; Store into __oserror, map to errno, return -1
 
+; Write whole blocks through MCIOUT while the kernal and device support it.
+; Only disk units can do block transfers.
+
+.Lblock:
+        lda     __rc10
+        cmp     #FIRST_DRIVE
+        bcc     3f              ; Not a disk unit
+
+        ldx     __rc4
+        dex
+        stx     __rc8
+        ldx     __rc5
+        dex
+        stx     __rc9           ; Undo the count bias from rwcommon
+
+.Lblockloop:
+        lda     #$FF            ; 256 or more left: send 255
+        ldx     __rc9
+        bne     .Lmciout
+        lda     __rc8           ; Less than 256 left: send all of it
+        beq     .Lbytewise      ; Nothing left; let the byte loop finish up
+
+.Lmciout:
+        ldx     __rc2
+        ldy     __rc3
+        clc                     ; Advance through the buffer
+        jsr     __cbm_mciout
+        bcs     .Lbytewise      ; No block transfers; fall back to BSOUT
+
+        stx     __rc12
+        sty     __rc13          ; Bytes written
+
+        txa
+        clc
+        adc     __rc2
+        sta     __rc2
+        tya
+        adc     __rc3
+        sta     __rc3           ; buf += n;
+
+        txa
+        clc
+        adc     __rc6
+        sta     __rc6
+        tya
+        adc     __rc7
+        sta     __rc7           ; Count characters written
+
+        sec
+        lda     __rc8
+        sbc     __rc12
+        sta     __rc8
+        lda     __rc9
+        sbc     __rc13
+        sta     __rc9           ; Decrement count
+
+        jsr     READST          ; Check the status
+        lsr     a               ; Bit zero is write timeout
+        beq     1f
+        jmp     devnotpresent
+1:      bcc     2f
+        jmp     4f
+
+2:      lda     __rc12
+        ora     __rc13
+        beq     .Lbytewise      ; No progress; let the byte loop carry on
+        jmp     .Lblockloop
+
+.Lbytewise:
+        ldx     __rc8
+        inx
+        stx     __rc4
+        ldx     __rc9
+        inx
+        stx     __rc5           ; Restore the count bias for the byte loop
+        jmp     3f
+
 ; Output the next character from the buffer
 
 1:      ldy     #0
@@ -0,0 +1,297 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#include <fixmath.h>
+
+// Everything is computed at 16.16 or finer and rounded to the result format.
+// The 8.8 versions either narrow their intermediate types or widen onto the
+// 16.16 path, whichever is cheaper for the function.
+
+// Shared with the binary-angle functions in <fixed_point_math.h>.
+const uint16_t __fix_sin_table[129] = {
+    0,     804,   1608,  2412,  3216,  4019,  4821,  5623,  6424,  7224,
+    8022,  8820,  9616,  10411, 11204, 11996, 12785, 13573, 14359, 15143,
+    15924, 16703, 17479, 18253, 19024, 19792, 20557, 21320, 22078, 22834,
+    23586, 24335, 25080, 25821, 26558, 27291, 28020, 28745, 29466, 30182,
+    30893, 31600, 32303, 33000, 33692, 34380, 35062, 35738, 36410, 37076,
+    37736, 38391, 39040, 39683, 40320, 40951, 41576, 42194, 42806, 43412,
+    44011, 44604, 45190, 45769, 46341, 46906, 47464, 48015, 48559, 49095,
+    49624, 50146, 50660, 51166, 51665, 52156, 52639, 53114, 53581, 54040,
+    54491, 54934, 55368, 55794, 56212, 56621, 57022, 57414, 57798, 58172,
+    58538, 58896, 59244, 59583, 59914, 60235, 60547, 60851, 61145, 61429,
+    61705, 61971, 62228, 62476, 62714, 62943, 63162, 63372, 63572, 63763,
+    63944, 64115, 64277, 64429, 64571, 64704, 64827, 64940, 65043, 65137,
+    65220, 65294, 65358, 65413, 65457, 65492, 65516, 65531, 65535,
+};
+
+const uint16_t __fix_atan_table[65] = {
+    0,     1024,  2047,  3070,  4091,  5110,  6126,  7140,  8150,  9156,
+    10158, 11155, 12147, 13133, 14114, 15088, 16055, 17015, 17968, 18913,
+    19850, 20779, 21699, 22610, 23512, 24406, 25289, 26163, 27028, 27882,
+    28727, 29561, 30386, 31200, 32003, 32797, 33580, 34353, 35115, 35867,
+    36608, 37340, 38060, 38771, 39472, 40162, 40842, 41512, 42172, 42823,
+    43464, 44095, 44716, 45328, 45931, 46525, 47109, 47685, 48251, 48809,
+    49359, 49899, 50432, 50956, 51472,
+};
+
+namespace {
+
+// 2^(i/32) in 1.31 for i in [0, 32).
+constexpr uint32_t exp2_table[32] = {
+    2147483648, 2194507417, 2242560872, 2291666561, 2341847524, 2393127307,
+    2445529972, 2499080105, 2553802834, 2609723834, 2666869345, 2725266179,
+    2784941738, 2845924021, 2908241642, 2971923842, 3037000500, 3103502151,
+    3171459999, 3240905930, 3311872529, 3384393094, 3458501653, 3534232978,
+    3611622603, 3690706840, 3771522796, 3854108391, 3938502376, 4024744348,
+    4112874773, 4202935003,
+};
+
+// 2^(j/1024) - 1 in 0.32 for j in [0, 32).
+constexpr uint32_t exp2_fine_table[32] = {
+    0,        2908254,  5818478,  8730672,  11644838, 14560977, 17479091,
+    20399181, 23321248, 26245293, 29171319, 32099326, 35029316, 37961289,
+    40895248, 43831194, 46769127, 49709050, 52650964, 55594870, 58540769,
+    61488663, 64438553, 67390441, 70344327, 73300213, 76258101, 79217992,
+    82179887, 85143788, 88109696, 91077612,
+};
+
+// 1/c in 1.15 and log(c) in 0.16 for c = 1 + i/32, i in [0, 32].
+constexpr uint16_t recip_table[33] = {
+    32768, 31775, 30840, 29959, 29127, 28340, 27594, 26887, 26214,
+    25575, 24966, 24385, 23831, 23302, 22795, 22310, 21845, 21400,
+    20972, 20560, 20165, 19784, 19418, 19065, 18725, 18396, 18079,
+    17772, 17476, 17190, 16913, 16644, 16384,
+};
+constexpr uint16_t log_table[33] = {
+    0,     2017,  3973,  5873,  7719,  9515,  11262, 12965, 14624,
+    16242, 17821, 19364, 20870, 22343, 23783, 25193, 26573, 27924,
+    29248, 30546, 31818, 33067, 34292, 35494, 36675, 37835, 38975,
+    40095, 41196, 42280, 43345, 44394, 45426,
+};
+
+constexpr int32_t PI = 205887;   // pi in 16.16
+constexpr int32_t PI_2 = 102944; // pi/2 in 16.16
+
+// Rounds a 16.16 value to 8.8, saturating.
+fix8_t narrow(int32_t x) {
+  x = (x + 0x80) >> 8;
+  if (x > INT16_MAX)
+    return FIX8_MAX;
+  if (x < INT16_MIN)
+    return FIX8_MIN;
+  return (fix8_t)x;
+}
+
+// Bits 16 through 47 of x * k, from 16-bit pieces so that no 64-bit multiply
+// is needed.
+uint32_t mul_hi16(int32_t x, uint32_t k) {
+  uint16_t xl = (uint16_t)x;
+  int32_t xh = x >> 16;
+  return (uint32_t)xh * k + (uint32_t)xl * (k >> 16) +
+         ((uint32_t)xl * (uint16_t)k >> 16);
+}
+
+// Bits 32 through 63 of a * b, from 16-bit pieces.
+uint32_t mul_hi32(uint32_t a, uint32_t b) {
+  uint16_t al = (uint16_t)a, ah = (uint16_t)(a >> 16);
+  uint16_t bl = (uint16_t)b, bh = (uint16_t)(b >> 16);
+  uint32_t lh = (uint32_t)al * bh;
+  uint32_t hl = (uint32_t)ah * bl;
+  uint32_t mid = ((uint32_t)al * bl >> 16) + (uint16_t)lh + (uint16_t)hl;
+  return (uint32_t)ah * bh + (lh >> 16) + (hl >> 16) + (mid >> 16);
+}
+
+// Rounded digit-by-digit square root of x * 4^extra.
+template <typename T> T sqrt_shifted(T x, uint8_t extra) {
+  T root = 0, rem = 0;
+  for (uint8_t i = sizeof(T) * 4 + extra; i; --i) {
+    rem = (T)(rem << 2 | x >> (sizeof(T) * 8 - 2));
+    x = (T)(x << 2);
+    T trial = (T)(root << 2 | 1);
+    root = (T)(root << 1);
+    if (rem >= trial) {
+      rem = (T)(rem - trial);
+      root |= 1;
+    }
+  }
+  // (root + 1/2)^2 = root^2 + root + 1/4.
+  if (rem > root)
+    ++root;
+  return root;
+}
+
+// Sine of an angle given in 2^-24 turns, in 16.16. The table is linearly
+// interpolated within each of its 512 steps per turn.
+int32_t sin_turn(uint32_t a) {
+  uint8_t quadrant = (uint8_t)(a >> 22) & 3;
+  uint32_t q = a & 0x3fffff;
+  if (quadrant & 1)
+    q = 0x400000 - q;
+  uint8_t i = (uint8_t)(q >> 15);
+  uint16_t frac = (uint16_t)q & 0x7fff;
+  const uint16_t *t = &__fix_sin_table[i];
+  int32_t s = t[0];
+  if (frac)
+    s += ((uint32_t)(uint16_t)(t[1] - t[0]) * frac + 0x4000) >> 15;
+  return (quadrant & 2) ? -s : s;
+}
+
+// x in radians (16.16) to 2^-24 turns, modulo one turn.
+uint32_t fix16_turn(fix16_t x) {
+  // 2^32 / (2*pi)
+  return mul_hi16(x, 683565276) >> 8;
+}
+
+// x in radians (8.8) to 2^-24 turns, modulo one turn. Only the low 32 bits of
+// the product matter, so an ordinary multiply suffices.
+uint32_t fix8_turn(fix8_t x) {
+  // 2^24 / (2*pi)
+  return (uint32_t)(int32_t)x * 2670177 >> 8;
+}
+
+// atan(lo/hi) in 16.16 for 0 <= lo <= hi.
+int32_t atan_ratio(uint32_t lo, uint32_t hi) {
+  if (!hi)
+    return 0;
+  // Keep lo << 16 in range; the ratio only carries 16 bits anyway.
+  while (hi >> 16) {
+    hi >>= 1;
+    lo >>= 1;
+  }
+  uint32_t t = (lo << 16) / (uint16_t)hi;
+  uint8_t i = (uint8_t)(t >> 10);
+  uint16_t frac = (uint16_t)t & 0x3ff;
+  const uint16_t *a = &__fix_atan_table[i];
+  int32_t r = a[0];
+  if (frac)
+    r += ((uint32_t)(uint16_t)(a[1] - a[0]) * frac + 0x200) >> 10;
+  return r;
+}
+
+int32_t atan2_q16(int32_t y, int32_t x) {
+  uint32_t ax = x < 0 ? -(uint32_t)x : (uint32_t)x;
+  uint32_t ay = y < 0 ? -(uint32_t)y : (uint32_t)y;
+  int32_t r = ay > ax ? PI_2 - atan_ratio(ax, ay) : atan_ratio(ay, ax);
+  if (x < 0)
+    r = PI - r;
+  return y < 0 ? -r : r;
+}
+
+} // namespace
+
+extern "C" {
+
+fix8_t fix8_round(fix8_t x) {
+  if (x >= 0)
+    return x > FIX8_MAX - 0x80 ? FIX8_MAX : (fix8_t)((x + 0x80) & ~0xff);
+  return x < FIX8_MIN + 0x80 ? FIX8_MIN : (fix8_t)-((-x + 0x80) & ~0xff);
+}
+
+fix16_t fix16_round(fix16_t x) {
+  if (x >= 0)
+    return x > FIX16_MAX - 0x8000 ? FIX16_MAX : (x + 0x8000) & ~0xffff;
+  return x < FIX16_MIN + 0x8000 ? FIX16_MIN : -((-x + 0x8000) & ~0xffff);
+}
+
+fix8_t fix8_sqrt(fix8_t x) {
+  if (x <= 0)
+    return 0;
+  return (fix8_t)sqrt_shifted<uint16_t>((uint16_t)x, 4);
+}
+
+fix16_t fix16_sqrt(fix16_t x) {
+  if (x <= 0)
+    return 0;
+  return (fix16_t)sqrt_shifted<uint32_t>((uint32_t)x, 8);
+}
+
+fix8_t fix8_sin(fix8_t x) { return narrow(sin_turn(fix8_turn(x))); }
+fix8_t fix8_cos(fix8_t x) {
+  return narrow(sin_turn(fix8_turn(x) + 0x400000));
+}
+fix16_t fix16_sin(fix16_t x) { return sin_turn(fix16_turn(x)); }
+fix16_t fix16_cos(fix16_t x) { return sin_turn(fix16_turn(x) + 0x400000); }
+
+fix8_t fix8_atan2(fix8_t y, fix8_t x) { return narrow(atan2_q16(y, x)); }
+fix16_t fix16_atan2(fix16_t y, fix16_t x) { return atan2_q16(y, x); }
+
+// exp(x) = 2^(x*log2(e)), split into 2^k * 2^(i/32) * 2^(j/1024) * 2^g with
+// g < 1/1024, where 2^g ~= 1 + g*ln(2) + (g*ln(2))^2/2. The fraction of
+// x*log2(e) and the product of the factors are carried in 32 bits, and the
+// result is rounded once after scaling by 2^k, so that even results near the
+// top of the range are within 2.5 ULPs.
+fix16_t fix16_exp(fix16_t x) {
+  // log(32768)
+  if (x > 681391)
+    return FIX16_MAX;
+  // log(2^-17)
+  if (x < -772243)
+    return 0;
+
+  // The fraction of x * log2(e) in 0.32, from x + x * (log2(e) - 1) with the
+  // latter constant in 0.48. Only the low 32 bits of each term matter.
+  uint32_t f = ((uint32_t)x << 16) + mul_hi16(x, 1901360722) +
+               (uint32_t)((int32_t)mul_hi16(x, 47152) >> 16);
+  // A coarse 16.16 x * log2(e) picks the integer part to go with it.
+  int32_t y = x + (int32_t)(int16_t)(x >> 8) * 113;
+  int8_t k = (int8_t)((y - (int32_t)(f >> 16) + 0x8000) >> 16);
+  if (k >= 15)
+    return FIX16_MAX;
+
+  uint8_t i = (uint8_t)(f >> 27);
+  uint8_t j = (uint8_t)(f >> 22) & 31;
+  // The remaining fraction times ln(2), with ln(2) in 0.24, in 0.32.
+  uint32_t t = (mul_hi16(f & 0x3fffff, 11629080) + 0x80) >> 8;
+  uint16_t th = (uint16_t)(t >> 8);
+  uint32_t p = t + ((uint32_t)th * th >> 17);
+  // 2^(j/1024) * 2^g - 1 in 0.32.
+  uint32_t b = exp2_fine_table[j];
+  uint32_t s = b + p + (mul_hi16(p, b) >> 16);
+  // 2^(i/32) * (1 + s) in 1.31.
+  uint32_t m = exp2_table[i];
+  m += mul_hi32(m, s);
+
+  // Round once, at the result's last place.
+  uint8_t shift = 15 - k;
+  return (fix16_t)(((m >> (shift - 1)) + 1) >> 1);
+}
+
+fix8_t fix8_exp(fix8_t x) {
+  // log(128)
+  if (x > 1242)
+    return FIX8_MAX;
+  return narrow(fix16_exp((int32_t)x << 8));
+}
+
+// log(x) = e*ln(2) + log(c) + log(m/c), where m in [1, 2) is the normalized
+// argument and c = 1 + i/32 the table entry nearest it; log(m/c) ~= r - r^2/2
+// with |r| <= 1/64.
+fix16_t fix16_log(fix16_t x) {
+  if (x <= 0)
+    return FIX16_MIN;
+  uint32_t n = (uint32_t)x;
+  int8_t e = 14;
+  while (!(n & 0x40000000)) {
+    n <<= 1;
+    --e;
+  }
+  // m in 1.16, rounded.
+  uint32_t m = (n + 0x2000) >> 14;
+  uint8_t i = (uint8_t)((m - 0x10000 + 0x400) >> 11);
+  int16_t d = (int16_t)(m - 0x10000 - ((uint32_t)i << 11));
+  int16_t r = (int16_t)((int32_t)d * recip_table[i] >> 15);
+  int32_t p = r - ((int32_t)r * r >> 17);
+  // e * ln(2), with ln(2) in 8.24.
+  int32_t el = ((int32_t)e * 11629080 + 0x80) >> 8;
+  return el + log_table[i] + p;
+}
+
+fix8_t fix8_log(fix8_t x) {
+  if (x <= 0)
+    return FIX8_MIN;
+  return narrow(fix16_log((int32_t)x << 8));
+}
+
+} // extern "C"
@@ -1,5 +1,7 @@
 #include <math.h>
 
+#include <stdint.h>
+
 template <typename T> static inline T _fmax(const T x, const T y) {
   if (isnan(y)) return x;
   // if x is nan, then x > y is false, so the ternary returns y
@@ -18,3 +20,327 @@ double fmax(double x, double y) { return _fmax<double>(x, y); }
 float fminf(float x, float y) { return _fmin<float>(x, y); }
 float fmaxf(float x, float y) { return _fmax<float>(x, y); }
 }
+
+// The single-precision functions below are built for a CPU without floating
+// point hardware, where every float add or multiply is a soft-float libcall
+// costing hundreds of cycles. Anything that can be done on the bit pattern is
+// done with integer operations, and the transcendental functions reduce their
+// argument onto a small table so that only a short polynomial remains.
+
+namespace {
+
+constexpr uint32_t SIGN = 0x80000000;
+constexpr uint32_t MANTISSA = 0x007fffff;
+constexpr uint32_t INF = 0x7f800000;
+
+uint32_t bits(float x) { return __builtin_bit_cast(uint32_t, x); }
+float from_bits(uint32_t u) { return __builtin_bit_cast(float, u); }
+
+// Biased exponent field of a float bit pattern, ignoring the sign.
+int biased_exponent(uint32_t u) { return (int)((u >> 23) & 0xff); }
+
+// Unbiased exponent of a float bit pattern.
+int exponent(uint32_t u) { return biased_exponent(u) - 127; }
+
+// sin(i * pi/128) for i in [0, 64].
+constexpr float sin_table[65] = {
+    0.0f,         0.024541229f, 0.0490676761f, 0.0735645667f, 0.0980171412f,
+    0.122410677f, 0.146730468f, 0.170961887f,  0.195090324f,  0.219101235f,
+    0.242980182f, 0.266712755f, 0.290284663f,  0.313681751f,  0.336889863f,
+    0.359895051f, 0.382683426f, 0.405241311f,  0.427555084f,  0.449611336f,
+    0.471396744f, 0.492898196f, 0.514102757f,  0.534997642f,  0.555570245f,
+    0.575808167f, 0.59569931f,  0.615231574f,  0.634393275f,  0.653172851f,
+    0.671558976f, 0.689540565f, 0.707106769f,  0.724247098f,  0.740951121f,
+    0.757208824f, 0.773010433f, 0.78834641f,   0.803207517f,  0.817584813f,
+    0.831469595f, 0.84485358f,  0.857728601f,  0.870086968f,  0.881921291f,
+    0.893224299f, 0.903989315f, 0.914209783f,  0.923879504f,  0.932992816f,
+    0.941544056f, 0.949528158f, 0.956940353f,  0.963776052f,  0.970031261f,
+    0.975702107f, 0.980785251f, 0.985277653f,  0.989176512f,  0.992479563f,
+    0.99518472f,  0.997290432f, 0.99879545f,   0.999698818f,  1.0f,
+};
+
+// atan(i/32) for i in [0, 32].
+constexpr float atan_table[33] = {
+    0.0f,         0.0312398337f, 0.062418811f,  0.0934767798f, 0.124354996f,
+    0.154996738f, 0.185347944f,  0.215357706f,  0.244978666f,  0.274167448f,
+    0.302884877f, 0.331096083f,  0.358770669f,  0.385882676f,  0.412410438f,
+    0.438336551f, 0.463647604f,  0.488333941f,  0.512389481f,  0.535811245f,
+    0.558599293f, 0.580756366f,  0.602287352f,  0.623199344f,  0.643501103f,
+    0.663203001f, 0.682316542f,  0.700854421f,  0.718829989f,  0.736257434f,
+    0.753151298f, 0.769526482f,  0.785398185f,
+};
+
+// 2^(i/32) for i in [0, 32).
+constexpr float exp2_table[32] = {
+    1.0f,        1.0218972f,  1.04427373f, 1.06714046f, 1.09050775f,
+    1.1143868f,  1.13878858f, 1.1637249f,  1.18920708f, 1.21524739f,
+    1.24185777f, 1.26905096f, 1.29683959f, 1.32523668f, 1.35425556f,
+    1.38390994f, 1.41421354f, 1.44518077f, 1.47682619f, 1.50916445f,
+    1.54221082f, 1.5759809f,  1.61049032f, 1.64575553f, 1.68179286f,
+    1.71861935f, 1.75625217f, 1.79470909f, 1.8340081f,  1.87416768f,
+    1.91520655f, 1.95714414f,
+};
+
+// 1/c and log(c) for c = 3/4 + i/32, i in [0, 24].
+constexpr float recip_table[25] = {
+    1.33333337f,  1.27999997f,  1.23076928f,  1.18518519f,  1.14285719f,
+    1.10344827f,  1.06666672f,  1.03225803f,  1.0f,         0.969696999f,
+    0.941176474f, 0.914285719f, 0.888888896f, 0.864864886f, 0.842105269f,
+    0.820512831f, 0.800000012f, 0.780487776f, 0.761904776f, 0.744186044f,
+    0.727272749f, 0.711111128f, 0.695652187f, 0.680851042f, 0.666666687f,
+};
+constexpr float log_table[25] = {
+    -0.287682086f, -0.246860072f,  -0.207639366f, -0.169899032f,
+    -0.133531392f, -0.0984400734f, -0.0645385236f, -0.0317486972f,
+    0.0f,          0.0307716578f,  0.0606246218f, 0.0896121562f,
+    0.117783032f,  0.145182014f,   0.171850264f,  0.197825745f,
+    0.223143548f,  0.247836158f,   0.271933705f,  0.295464218f,
+    0.318453729f,  0.340926588f,   0.362905502f,  0.384411693f,
+    0.405465096f,
+};
+
+constexpr float PI = 3.14159274f;
+constexpr float PI_2 = 1.57079637f;
+
+// pi/128 and ln(2)/32, split so that multiples of the high part by small
+// integers are exact.
+constexpr float PI_128_HI = 0x1.922p-6f;
+constexpr float PI_128_LO = -0x1.2aeef4p-24f;
+constexpr float LN2_32_HI = 0x1.63p-6f;
+constexpr float LN2_32_LO = -0x1.bd0106p-18f;
+constexpr float LN2_HI = 0x1.62e4p-1f;
+constexpr float LN2_LO = 0x1.7f7d1cp-20f;
+
+// sin(i * pi/128) for any i, by quarter-wave symmetry.
+float sin_step(uint8_t i) {
+  uint8_t j = i & 63;
+  float s = (i & 64) ? sin_table[64 - j] : sin_table[j];
+  return (i & 128) ? -s : s;
+}
+
+// sin(x + offset * pi/128). The argument is reduced to the nearest table
+// step, leaving |d| <= pi/256, where sin(d) and cos(d) need only two terms.
+float sin_offset(float x, uint8_t offset) {
+  if ((bits(x) & ~SIGN) >= INF)
+    return x - x;
+  float n = roundf(x * 40.7436638f);
+  // Floats this large are multiples of 256, so the step index wraps to zero.
+  uint8_t i = fabsf(n) < 0x1p31f ? (uint8_t)(int32_t)n : 0;
+  float d = (x - n * PI_128_HI) - n * PI_128_LO;
+  // Past about 2^16 the reduction itself loses precision; keep the result in
+  // range rather than letting the polynomial run away.
+  if ((bits(d) & ~SIGN) > bits(PI_128_HI))
+    d = 0.0f;
+  float d2 = d * d;
+  i += offset;
+  return sin_step(i) * (1.0f - 0.5f * d2) +
+         sin_step(i + 64) * (d - d * d2 * (1.0f / 6));
+}
+
+// Rounds t in [0, 1] to the nearest multiple of 1/32, as an integer in
+// [0, 32].
+uint8_t nearest_32nd(float t) {
+  uint32_t u = bits(t);
+  int e = exponent(u);
+  if (e < -6)
+    return 0;
+  uint32_t m = (u & MANTISSA) | (MANTISSA + 1);
+  return (uint8_t)(((m >> (17 - e)) + 1) >> 1);
+}
+
+} // namespace
+
+extern "C" {
+
+float fabsf(float x) { return from_bits(bits(x) & ~SIGN); }
+
+float floorf(float x) {
+  uint32_t u = bits(x);
+  int e = exponent(u);
+  // Already integral, infinite, or NaN.
+  if (e >= 23)
+    return x;
+  if (e < 0) {
+    if (!(u << 1))
+      return x;
+    return (u & SIGN) ? -1.0f : 0.0f;
+  }
+  uint32_t m = MANTISSA >> e;
+  if (!(u & m))
+    return x;
+  // Negative values round away from zero; the carry may bump the exponent.
+  if (u & SIGN)
+    u += m;
+  return from_bits(u & ~m);
+}
+
+float roundf(float x) {
+  uint32_t u = bits(x);
+  int e = exponent(u);
+  if (e >= 23)
+    return x;
+  if (e < -1)
+    return from_bits(u & SIGN);
+  if (e == -1)
+    return from_bits((u & SIGN) | 0x3f800000);
+  uint32_t m = MANTISSA >> e;
+  if (!(u & m))
+    return x;
+  u += (MANTISSA + 1) >> 1 >> e;
+  return from_bits(u & ~m);
+}
+
+// Bit-by-bit square root of the mantissa. This is correctly rounded and uses
+// only 32-bit integer adds, compares, and shifts.
+float sqrtf(float x) {
+  uint32_t u = bits(x);
+  if (!(u << 1))
+    return x;
+  if (u >= INF) {
+    if (u == INF || (u & ~SIGN) > INF)
+      return x;
+    return __builtin_nanf("");
+  }
+
+  int e = biased_exponent(u);
+  uint32_t m = u & MANTISSA;
+  if (!e) {
+    // Normalize a subnormal.
+    e = 1;
+    while (!(m & (MANTISSA + 1))) {
+      m <<= 1;
+      --e;
+    }
+  } else {
+    m |= MANTISSA + 1;
+  }
+  e -= 127;
+  // Make the exponent even so it can be halved exactly.
+  if (e & 1)
+    m <<= 1;
+  e >>= 1;
+
+  m <<= 1;
+  uint32_t q = 0, s = 0;
+  for (uint32_t r = 0x01000000; r; r >>= 1) {
+    uint32_t t = s + r;
+    if (t <= m) {
+      s = t + r;
+      m -= t;
+      q += r;
+    }
+    m <<= 1;
+  }
+  // Round to nearest; a nonzero remainder means the result isn't a tie.
+  if (m)
+    q += q & 1;
+  return from_bits((q >> 1) + 0x3f000000 + ((uint32_t)e << 23));
+}
+
+float sinf(float x) { return sin_offset(x, 0); }
+
+float cosf(float x) { return sin_offset(x, 64); }
+
+// atan(t) = atan(i/32) + atan(d), where d = (t - i/32) / (1 + t*i/32) is at
+// most 1/64, so atan(d) needs only two terms.
+float atan2f(float y, float x) {
+  if (isnan(x) || isnan(y))
+    return x + y;
+  float ax = fabsf(x);
+  float ay = fabsf(y);
+  bool swap = ay > ax;
+  float lo = swap ? ax : ay;
+  float hi = swap ? ay : ax;
+
+  float r;
+  if ((bits(lo) & ~SIGN) == INF) {
+    r = PI / 4;
+  } else if (hi == 0.0f) {
+    r = 0.0f;
+  } else {
+    float t = lo / hi;
+    uint8_t i = nearest_32nd(t);
+    float c = (float)i * 0x1p-5f;
+    float d = (t - c) / (1.0f + t * c);
+    r = atan_table[i] + (d - d * d * d * (1.0f / 3));
+  }
+
+  if (swap)
+    r = PI_2 - r;
+  if (bits(x) & SIGN)
+    r = PI - r;
+  return (bits(y) & SIGN) ? -r : r;
+}
+
+// exp(x) = 2^(n/32) * exp(r), with |r| <= ln(2)/64.
+float expf(float x) {
+  if (isnan(x))
+    return x;
+  if (x > 88.7228394f)
+    return __builtin_inff();
+  if (x < -103.972084f)
+    return 0.0f;
+
+  float nf = roundf(x * 46.1662407f);
+  int n = (int)nf;
+  float r = (x - nf * LN2_32_HI) - nf * LN2_32_LO;
+  float p = r + r * r * (0.5f + r * (1.0f / 6));
+  float m = exp2_table[n & 31];
+  uint32_t u = bits(m + m * p);
+
+  // Scale by 2^k by adjusting the exponent field directly.
+  int k = n >> 5;
+  int e = biased_exponent(u) + k;
+  if (e >= 255)
+    return __builtin_inff();
+  if (e > 0)
+    return from_bits(u + ((uint32_t)k << 23));
+  // Let a float multiply round the subnormal result.
+  return from_bits(u + ((uint32_t)(k + 64) << 23)) * 0x1p-64f;
+}
+
+// log(x) = e*ln(2) + log(c) + log(m/c), where m is the mantissa scaled into
+// [3/4, 3/2) and c = 3/4 + i/32 is the table entry nearest it, so
+// |m/c - 1| <= 1/48. Centering the mantissa on 1 keeps log(c) small near
+// x = 1, so its rounding error doesn't swamp results close to zero.
+float logf(float x) {
+  uint32_t u = bits(x);
+  if (!(u << 1))
+    return -__builtin_inff();
+  if (u >= INF) {
+    if (u == INF || (u & ~SIGN) > INF)
+      return x;
+    return __builtin_nanf("");
+  }
+
+  int e = biased_exponent(u);
+  if (!e) {
+    u = bits(x * 0x1p23f);
+    e = biased_exponent(u) - 23;
+  }
+  e -= 127;
+
+  uint32_t mant = u & MANTISSA;
+  uint32_t mb;
+  uint8_t i;
+  uint32_t cb;
+  if (mant < 0x400000) {
+    // m in [1, 3/2)
+    mb = mant | 0x3f800000;
+    i = (uint8_t)((mant + 0x20000) >> 18);
+    cb = 0x3f800000 + ((uint32_t)i << 18);
+    i += 8;
+  } else {
+    // m/2 in [3/4, 1)
+    mb = mant | 0x3f000000;
+    ++e;
+    i = (uint8_t)((mant - 0x3c0000) >> 19);
+    cb = 0x3f400000 + ((uint32_t)i << 19);
+  }
+  float r = (from_bits(mb) - from_bits(cb)) * recip_table[i];
+  float p = r - r * r * (0.5f - r * (1.0f / 3 - r * 0.25f));
+  float ef = (float)e;
+  return (ef * LN2_HI + log_table[i]) + (ef * LN2_LO + p);
+}
+
+} // extern "C"
@@ -27,6 +27,20 @@ void put(char c, Status *status) {
   ++status->i;
 }
 
+// Writes a run of characters in one go: a single fwrite() for streams, or a
+// single memcpy() for buffers.
+void put_n(const char *s, size_t len, Status *status) {
+  if (status->i < status->n) {
+    if (status->stream) {
+      fwrite(s, 1, len, status->stream);
+    } else {
+      size_t avail = status->n - status->i;
+      memcpy(status->s + status->i, s, len < avail ? len : avail);
+    }
+  }
+  status->i += len;
+}
+
 #define E_minus (INT32_C(1) << 0)
 #define E_plus (INT32_C(1) << 1)
 #define E_alt (INT32_C(1) << 2)
@@ -63,8 +77,7 @@ void print_string(const char *s, Status *status) {
   if (!(status->flags & E_minus))
     print_string_padding(prec, status);
 
-  while (prec-- > 0)
-    put(*s++, status);
+  put_n(s, prec, status);
 
   if (status->flags & E_minus)
     print_string_padding(prec, status);
@@ -95,6 +108,7 @@ public:
   const char *bytes() const { return (const char *)&size_ + sizeof(size_); };
 
   Size size() const { return size_; }
+  void set_size(Size size) { size_ = size; }
 
   BcdVarInt &operator++();
 
@@ -226,20 +240,119 @@ void print_bcd_int(BcdVarInt &value, bool negative, Status *status) {
   while (prec-- > value.size())
     put('0', status);
 
-  if (value.size()) {
-    for (char i = value.size() - 1; i != 0; i--)
-      put(bcd_to_char(value.bytes()[i], status->flags & E_lower), status);
-    put(bcd_to_char(value.bytes()[0], status->flags & E_lower), status);
+  // Convert the digits to characters in place, most significant first, so they
+  // can be written all at once.
+  char *digits = value.bytes();
+  BcdVarInt::Size n = value.size();
+  for (BcdVarInt::Size i = 0; i < n / 2; ++i) {
+    char tmp = digits[i];
+    digits[i] = digits[n - 1 - i];
+    digits[n - 1 - i] = tmp;
   }
+  for (BcdVarInt::Size i = 0; i < n; ++i)
+    digits[i] = bcd_to_char(digits[i], status->flags & E_lower);
+  put_n(digits, n, status);
 
   if (status->flags & E_minus)
     for (; padding; --padding)
       put(' ', status);
 }
 
+// Fast paths for the common narrow cases. Double dabble touches every BCD digit
+// once per input bit, so even an 8-bit value costs 8 passes over the digits.
+// Instead, decimal digits are peeled off most-significant first by repeated
+// subtraction of powers of ten, narrowing the working type as soon as the
+// remainder fits. Each digit costs at most 9 subtractions at the current
+// width.
+
+// Emits the count of times pow can be subtracted from value as a digit. Leading
+// zeros are suppressed by only emitting once a nonzero digit has been seen.
+template <typename T> T sub_digit(T value, T pow, char *digits, char &n) {
+  char d = 0;
+  while (value >= pow) {
+    value -= pow;
+    ++d;
+  }
+  if (d || n)
+    digits[n++] = d;
+  return value;
+}
+
+// Finishes a value below 100.
+void dec_tail_8(uint8_t value, char *digits, char &n) {
+  value = sub_digit<uint8_t>(value, 10, digits, n);
+  if (value || n)
+    digits[n++] = value;
+}
+
+// Finishes a value below 10000.
+void dec_tail_16(uint16_t value, char *digits, char &n) {
+  value = sub_digit<uint16_t>(value, 1000, digits, n);
+  value = sub_digit<uint16_t>(value, 100, digits, n);
+  dec_tail_8(value, digits, n);
+}
+
+void u8_to_dec(uint8_t value, char *digits, char &n) {
+  dec_tail_8(sub_digit<uint8_t>(value, 100, digits, n), digits, n);
+}
+
+void u16_to_dec(uint16_t value, char *digits, char &n) {
+  dec_tail_16(sub_digit<uint16_t>(value, 10000, digits, n), digits, n);
+}
+
+const uint32_t pow10_32[] = {1000000000, 100000000, 10000000,
+                             1000000,    100000,    10000};
+
+void u32_to_dec(uint32_t value, char *digits, char &n) {
+  for (uint32_t pow : pow10_32)
+    value = sub_digit(value, pow, digits, n);
+  dec_tail_16(value, digits, n);
+}
+
+// Converts a value of at most 32 bits to base-10 BCD. The digits are produced
+// most-significant first, while BcdVarInt stores them least-significant first.
+void small_int_to_dec_bcd(const VarInt &value, BcdVarInt &bcd) {
+  char digits[sizeof("4294967295") - 1];
+  char n = 0;
+  switch (value.size()) {
+  case 1:
+    u8_to_dec(value, digits, n);
+    break;
+  case 2:
+    u16_to_dec(value, digits, n);
+    break;
+  default:
+    u32_to_dec(value, digits, n);
+    break;
+  }
+  for (char i = 0; i < n; ++i)
+    bcd.bytes()[i] = digits[n - 1 - i];
+  bcd.set_size(n);
+}
+
+// Hex digits are just the nibbles of the value, so no arithmetic is needed at
+// any width.
+void int_to_hex_bcd(const VarInt &value, BcdVarInt &bcd) {
+  BcdVarInt::Size size = 0;
+  for (char i = 0; i < value.size(); ++i) {
+    unsigned char byte = value.bytes()[i];
+    bcd.bytes()[size++] = byte & 0xf;
+    bcd.bytes()[size++] = byte >> 4;
+  }
+  while (size && !bcd.bytes()[size - 1])
+    --size;
+  bcd.set_size(size);
+}
+
 void print_int(VarInt &value, bool negative, Status *status) {
-  BcdBigInt<sizeof("18446744073709551615")> bcd(status->base);
-  int_to_bcd(value, bcd);
+  // Large enough for the longest 64-bit value in any base, which is octal.
+  BcdBigInt<sizeof("1777777777777777777777")> bcd(status->base);
+  if (status->base == 16)
+    int_to_hex_bcd(value, bcd);
+  else if (status->base == 10 && value.size() <= sizeof(uint32_t))
+    small_int_to_dec_bcd(value, bcd);
+  else
+    int_to_bcd(value, bcd);
   print_bcd_int(bcd, negative, status);
 }
 
@@ -832,6 +945,16 @@ flags_done:;
   return ++spec;
 }
 
+// Returns the length of the literal text at the start of format. The first
+// character is always included, since it may be a '%' that failed to parse as
+// a conversion specifier.
+size_t literal_len(const char *format) {
+  size_t len = 1;
+  while (format[len] && format[len] != '%')
+    ++len;
+  return len;
+}
+
 } // namespace
 
 extern "C" {
@@ -891,10 +1014,12 @@ __attribute__((weak)) int vfprintf(FILE *__restrict__ stream,
     const char *rc;
 
     if ((*format != '%') || ((rc = print(format, &status)) == format)) {
-      /* No conversion specifier, print verbatim */
-      if (putc(*format++, stream) == EOF)
+      /* No conversion specifier, print verbatim up to the next one */
+      size_t len = literal_len(format);
+      if (fwrite(format, 1, len, stream) != len)
         return EOF;
-      status.i++;
+      status.i += len;
+      format += len;
     } else {
       /* Continue parsing after conversion specifier */
       format = rc;
@@ -926,12 +1051,10 @@ __attribute__((weak)) int vsnprintf(char *__restrict__ s, size_t n,
     const char *rc;
 
     if ((*format != '%') || ((rc = print(format, &status)) == format)) {
-      /* No conversion specifier, print verbatim */
-      if (status.i < n)
-        s[status.i] = *format;
-
-      status.i++;
-      format++;
+      /* No conversion specifier, print verbatim up to the next one */
+      size_t len = literal_len(format);
+      put_n(format, len, &status);
+      format += len;
     } else {
       /* Continue parsing after conversion specifier */
       format = rc;
@@ -0,0 +1,46 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#include <radix_sort.h>
+
+// With at most 255 keys, every count and bucket offset fits in a byte, and
+// the histogram is indexed directly by key.
+static uint8_t count[256];
+
+// Build the histogram of keys, then turn it into the starting offset of each
+// bucket.
+static void histogram(const uint8_t *keys, uint8_t n) {
+  uint8_t i = 0;
+  do
+    count[i] = 0;
+  while (++i);
+  for (i = 0; i < n; ++i)
+    ++count[keys[i]];
+  uint8_t sum = 0;
+  i = 0;
+  do {
+    uint8_t c = count[i];
+    count[i] = sum;
+    sum += c;
+  } while (++i);
+}
+
+void radix_sort_u8(const uint8_t *keys, uint8_t n, uint8_t *perm) {
+  histogram(keys, n);
+  for (uint8_t i = 0; i < n; ++i)
+    perm[count[keys[i]]++] = i;
+}
+
+// Least significant byte first; the second pass is stable, so ties on the
+// high byte keep their low byte order.
+void radix_sort_u16(const uint8_t *keys_lo, const uint8_t *keys_hi, uint8_t n,
+                    uint8_t *perm, uint8_t *tmp) {
+  radix_sort_u8(keys_lo, n, tmp);
+  histogram(keys_hi, n);
+  for (uint8_t j = 0; j < n; ++j) {
+    uint8_t i = tmp[j];
+    perm[count[keys_hi[i]]++] = i;
+  }
+}
@@ -88,6 +88,19 @@ bool in_scanset(const char *scanlist, const char *end_scanlist, int rc) {
   return false;
 }
 
+// Multiplies by an integer conversion's base (8, 10, or 16) using shifts and
+// adds.
+uint16_t mul_base(uint16_t v, signed char base) {
+  switch (base) {
+  case 8:
+    return v << 3;
+  case 16:
+    return v << 4;
+  default:
+    return (v << 3) + (v << 1);
+  }
+}
+
 const char *scan(const char *spec, Status *status) {
   /* generic input character */
   int rc;
@@ -378,6 +391,12 @@ const char *scan(const char *spec, Status *status) {
     VarInt &value = VarInt::make(space, size);
     value.zero();
 
+    // Destinations of at most 16 bits are accumulated in a native integer
+    // instead of the VarInt; both wrap modulo 2^16, and the low bytes are
+    // copied over at the end.
+    bool narrow = size <= sizeof(uint16_t);
+    uint16_t narrow_value = 0;
+
     bool prefix_parsed = false;
     signed char sign = 0;
 
@@ -460,8 +479,12 @@ const char *scan(const char *spec, Status *status) {
               break;
             }
 
-            value *= status->base;
-            value += digit;
+            if (narrow) {
+              narrow_value = mul_base(narrow_value, status->base) + digit;
+            } else {
+              value *= status->base;
+              value += digit;
+            }
             value_parsed = true;
           }
         }
@@ -479,6 +502,9 @@ const char *scan(const char *spec, Status *status) {
       return NULL;
     }
 
+    if (narrow)
+      memcpy(value.bytes(), &narrow_value, size);
+
     /* convert value to target type and assign to parameter */
     if (!(status->flags & E_suppressed)) {
       if (sign == -1)
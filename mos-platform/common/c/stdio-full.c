@@ -453,27 +453,38 @@ static int prep_read(FILE *stream) {
   return 0;
 }
 
-static int fill_buffer(FILE *stream) {
-  /* No need to handle buffers > INT_MAX, as PDCLib doesn't allow them */
-  int rc = read(stream->handle, stream->buffer, stream->bufsize);
+/* A system call that reads up to n bytes from a stream's handle into dest.
+   Returns the number of bytes read, or 0 on error or end-of-file.
+   Sets stream error/EOF flags appropriately.
+*/
+static size_t read_handle(FILE *stream, char *dest, size_t n) {
+  if (n > INT_MAX)
+    n = INT_MAX;
+  int rc = read(stream->handle, dest, n);
 
   if (rc > 0) {
     /* Reading successful. */
     stream->pos += rc;
-    stream->bufend = rc;
-    stream->bufidx = 0;
-    return 0;
+    return (size_t)rc;
   }
 
-  if (rc < 0) {
+  if (rc < 0)
     /* Flag the stream */
     stream->status |= ERRORFLAG;
-    return EOF;
-  }
+  else
+    /* End-of-File */
+    stream->status |= EOFFLAG;
+  return 0;
+}
 
-  /* End-of-File */
-  stream->status |= EOFFLAG;
-  return EOF;
+static int fill_buffer(FILE *stream) {
+  /* No need to handle buffers > INT_MAX, as PDCLib doesn't allow them */
+  size_t rc = read_handle(stream, stream->buffer, stream->bufsize);
+  if (!rc)
+    return EOF;
+  stream->bufend = rc;
+  stream->bufidx = 0;
+  return 0;
 }
 
 __attribute__((always_inline)) static int read_byte(void *ctx) {
@@ -493,6 +504,67 @@ static int read_char(FILE *stream) {
                                : __to_ascii(stream, read_byte);
 }
 
+// Copies n characters from src to dst, translating them through table unless
+// it is null.
+static void copy_chars(char *dst, const char *src, size_t n,
+                       const char *table) {
+  if (!table) {
+    memcpy(dst, src, n);
+    return;
+  }
+  for (; n; --n)
+    *dst++ = table[(unsigned char)*src++];
+}
+
+// Reads a run of characters from a stream that has passed prep_read(). Binary
+// streams, and text streams on targets with a __to_ascii_table, copy buffered
+// bytes out in bulk. Once the buffer is drained, any remainder at least as
+// large as the buffer is read straight into the destination and translated
+// in place. Returns the number of characters read.
+static size_t read_chars(char *s, size_t n, FILE *stream) {
+  size_t i = 0;
+  const char *table = stream->status & FBIN ? NULL : __to_ascii_table;
+  if (!(stream->status & FBIN) && !table) {
+    for (; i < n; ++i) {
+      int c = read_char(stream);
+      if (c == EOF)
+        break;
+      s[i] = (char)c;
+    }
+    return i;
+  }
+
+  if (n && stream->ungetc_buf_full) {
+    stream->ungetc_buf_full = false;
+    s[i++] = stream->ungetc_buf;
+  }
+  while (i < n) {
+    size_t chunk = stream->bufend - stream->bufidx;
+    if (!chunk) {
+      if (n - i >= stream->bufsize) {
+        // The buffer is empty, so its indices stay equal and ftell() sees
+        // the new position directly.
+        size_t rc = read_handle(stream, s + i, n - i);
+        if (!rc)
+          break;
+        if (table)
+          copy_chars(s + i, s + i, rc, table);
+        i += rc;
+        continue;
+      }
+      if (fill_buffer(stream) == EOF)
+        break;
+      chunk = stream->bufend;
+    }
+    if (chunk > n - i)
+      chunk = n - i;
+    copy_chars(s + i, stream->buffer + stream->bufidx, chunk, table);
+    stream->bufidx += chunk;
+    i += chunk;
+  }
+  return i;
+}
+
 int fgetc(FILE *stream) {
   if (prep_read(stream) == EOF)
     return EOF;
@@ -562,6 +634,51 @@ static int write_char(char c, FILE *stream) {
   return 0;
 }
 
+// Writes a run of characters to a stream that has passed prep_write(). Binary
+// streams, and text streams on targets with a __from_ascii_table, copy the run
+// into the buffer in bulk, flushing only when the buffer fills. On binary
+// streams, any remainder at least as large as the buffer is written straight
+// from the caller's memory once the buffer has been flushed. Returns the
+// number of characters consumed.
+static size_t write_chars(const char *s, size_t n, FILE *stream) {
+  size_t i = 0;
+  const char *table = stream->status & FBIN ? NULL : __from_ascii_table;
+  if (!(stream->status & FBIN) && !table) {
+    for (; i < n; ++i)
+      if (write_char(s[i], stream) == EOF)
+        break;
+    return i;
+  }
+
+  while (i < n) {
+    if (!table && n - i >= stream->bufsize) {
+      if (stream->bufidx && flush_buffer(stream) == EOF)
+        return i;
+      size_t chunk = n - i > INT_MAX ? INT_MAX : n - i;
+      int rc = write(stream->handle, s + i, chunk);
+      if (rc < 0) {
+        stream->status |= ERRORFLAG;
+        return i;
+      }
+      stream->pos += rc;
+      i += (size_t)rc;
+      continue;
+    }
+    size_t chunk = stream->bufsize - stream->bufidx;
+    if (chunk > n - i)
+      chunk = n - i;
+    copy_chars(stream->buffer + stream->bufidx, s + i, chunk, table);
+    stream->bufidx += chunk;
+    i += chunk;
+    if (stream->bufidx == stream->bufsize)
+      if (flush_buffer(stream) == EOF)
+        return i;
+  }
+  if ((stream->status & _IOLBF) && memchr(s, '\n', n))
+    flush_buffer(stream);
+  return i;
+}
+
 int fputc(int c, FILE *stream) {
   if (prep_write(stream) == EOF)
     return EOF;
@@ -576,9 +693,9 @@ int fputc(int c, FILE *stream) {
 int fputs(const char *restrict s, FILE *restrict stream) {
   if (prep_write(stream) == EOF)
     return EOF;
-  for (; *s; ++s)
-    if (write_char(*s, stream) == EOF)
-      return EOF;
+  size_t len = strlen(s);
+  if (write_chars(s, len, stream) != len)
+    return EOF;
   if (stream->status & _IONBF)
     if (flush_buffer(stream) == EOF)
       return EOF;
@@ -592,9 +709,9 @@ int putchar(int c) { return putc(c, stdout); }
 int puts(const char *s) {
   if (prep_write(stdout) == EOF)
     return EOF;
-  for (; *s; ++s)
-    if (write_char(*s, stdout) == EOF)
-      return EOF;
+  size_t len = strlen(s);
+  if (write_chars(s, len, stdout) != len)
+    return EOF;
   if (write_char('\n', stdout) == EOF)
     return EOF;
   if (stdout->status & _IONBF)
@@ -614,38 +731,20 @@ int ungetc(int c, FILE *stream) {
 
 size_t fread(void *restrict ptr, size_t size, size_t nmemb,
              FILE *restrict stream) {
-  char *dest = (char *)ptr;
-  if (prep_read(stream) == EOF)
+  if (prep_read(stream) == EOF || !size)
     return 0;
-  size_t nmemb_i;
-  for (nmemb_i = 0; nmemb_i < nmemb; ++nmemb_i) {
-    /* TODO: For better performance, move from stream buffer
-       to destination block-wise, not byte-wise.
-    */
-    for (size_t size_i = 0; size_i < size; ++size_i) {
-      int c = read_char(stream);
-      if (c == EOF)
-        return nmemb_i;
-      dest[nmemb_i * size + size_i] = (char)c;
-    }
-  }
-  return nmemb_i;
+  return read_chars((char *)ptr, size * nmemb, stream) / size;
 }
 
 size_t fwrite(const void *restrict ptr, size_t size, size_t nmemb,
               FILE *restrict stream) {
-  size_t nmemb_i;
-
-  if (prep_write(stream) == EOF)
+  if (prep_write(stream) == EOF || !size)
     return 0;
 
-  for (nmemb_i = 0; nmemb_i < nmemb; ++nmemb_i) {
-    for (size_t size_i = 0; size_i < size; ++size_i) {
-      char c = ((char *)ptr)[nmemb_i * size + size_i];
-      if (write_char(c, stream) == EOF)
-        return nmemb_i;
-    }
-  }
+  size_t len = size * nmemb;
+  size_t written = write_chars((const char *)ptr, len, stream);
+  if (written != len)
+    return written / size;
 
   if (stream->status & _IONBF) {
     if (flush_buffer(stream) == EOF) {
@@ -656,10 +755,10 @@ size_t fwrite(const void *restrict ptr, size_t size, size_t nmemb,
          Catch 22. We'll return a value one short, to indicate the
          error, and can't really do anything about the inconsistency.
       */
-      return nmemb_i - 1;
+      return nmemb - 1;
     }
   }
-  return nmemb_i;
+  return nmemb;
 }
 
 // File positioning functions
@@ -10,6 +10,18 @@ __attribute__((weak)) FILE *stdin = (FILE *)1;
 __attribute__((weak)) FILE *stdout = (FILE *)2;
 __attribute__((weak)) FILE *stderr = (FILE *)3;
 
+static int putchar_wrapper(char c, void *ctx) {
+  __putchar(c);
+  return 0;
+}
+
+// Goes through putchar, so that a program overriding it still sees the output
+// of puts, fputs, and fwrite.
+__attribute__((weak)) void __putchars(const char *s, size_t n) {
+  for (; n; --n)
+    putchar(*s++);
+}
+
 // Character input/output functions
 
 __attribute__((weak)) int fgetc(FILE *stream) { return getchar(); }
@@ -30,8 +42,7 @@ __attribute__((weak)) int fputc(int c, FILE *stream) { return putchar(c); }
 
 __attribute__((weak)) int fputs(const char *__restrict__ s,
                                 FILE *__restrict__ stream) {
-  for (; *s; ++s)
-    putchar(*s);
+  __putchars(s, strlen(s));
   return 0;
 }
 
@@ -51,18 +62,13 @@ __attribute__((weak)) int getchar(void) {
 
 int putc(int c, FILE *stream) { return fputc(c, stream); }
 
-static int putchar_wrapper(char c, void *ctx) {
-  __putchar(c);
-  return 0;
-}
 __attribute__((weak)) int putchar(int c) {
   __from_ascii(c, NULL, putchar_wrapper);
   return c;
 }
 
 __attribute__((weak)) int puts(const char *s) {
-  for (; *s; ++s)
-    putchar(*s);
+  __putchars(s, strlen(s));
   putchar('\n');
   return 0;
 }
@@ -95,12 +101,14 @@ __attribute__((weak)) size_t fwrite(const void *__restrict ptr, size_t size,
   if (!size)
     return 0;
 
-  const unsigned char *cptr = (const unsigned char *)ptr;
-  size_t n;
-  for (n = 0; n < nmemb; ++n)
-    for (size_t s = size; s; --s)
-      fputc(*cptr++, stream);
-  return n;
+  // No object is this large, so write only the whole elements that fit.
+  size_t len;
+  if (__builtin_mul_overflow(size, nmemb, &len)) {
+    nmemb = SIZE_MAX / size;
+    len = size * nmemb;
+  }
+  __putchars((const char *)ptr, len);
+  return nmemb;
 }
 
 // File positioning functions
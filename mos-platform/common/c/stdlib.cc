@@ -121,6 +121,67 @@ const char *strtox_prelim(const char *p, char *sign, char *base) {
   return p;
 }
 
+// Skips the remaining digits of an out-of-range value and saturates the result.
+bool strtox_overflow(const char **p, char base, bool is_signed, bool negative,
+                     VarInt &rc) {
+  errno = ERANGE;
+
+  while (__parse_digit(**p, base) != -1)
+    ++(*p);
+
+  if (is_signed) {
+    if (negative)
+      rc.negative_limit();
+    else
+      rc.positive_limit();
+  } else {
+    rc.unsigned_limit();
+  }
+  return true;
+}
+
+template <char Base> signed char fast_digit(char c) {
+  unsigned char d = c - '0';
+  if (d < 10)
+    return d;
+  if constexpr (Base == 16) {
+    d = (c | 0x20) - 'a';
+    if (d < 6)
+      return d + 10;
+  }
+  return -1;
+}
+
+// Fast path for 8 and 16-bit results in base 10 or 16. The value is kept in a
+// native register-sized integer and multiplied by the base with shifts and
+// adds, rather than the general VarInt multiply-add. Overflow is detected
+// before it can happen, and is then handled exactly as in the VarInt path.
+template <typename T, char Base>
+bool strtox_fast(const char **p, bool is_signed, bool negative, VarInt &rc) {
+  constexpr T max = T(~T(0));
+  constexpr T sign_bit = T(1) << (sizeof(T) * 8 - 1);
+  T limit = !is_signed ? max : negative ? sign_bit : T(sign_bit - 1);
+
+  T value = 0;
+  for (signed char digit; (digit = fast_digit<Base>(**p)) >= 0; ++(*p)) {
+    if (value > max / Base)
+      return strtox_overflow(p, Base, is_signed, negative, rc);
+    T shifted = Base == 16 ? T(value << 4) : T((value << 3) + (value << 1));
+    value = shifted + digit;
+    if (value < shifted || value > limit)
+      return strtox_overflow(p, Base, is_signed, negative, rc);
+  }
+  rc = value;
+  return false;
+}
+
+template <typename T>
+bool strtox_fast(const char **p, char base, bool is_signed, bool negative,
+                 VarInt &rc) {
+  return base == 10 ? strtox_fast<T, 10>(p, is_signed, negative, rc)
+                    : strtox_fast<T, 16>(p, is_signed, negative, rc);
+}
+
 bool strtox_main(const char **p, char base, bool is_signed, bool negative,
                  VarInt &rc) {
   rc.zero();
@@ -131,6 +192,13 @@ bool strtox_main(const char **p, char base, bool is_signed, bool negative,
     return false;
   }
 
+  if (base == 10 || base == 16) {
+    if (rc.size() == 1)
+      return strtox_fast<uint8_t>(p, base, is_signed, negative, rc);
+    if (rc.size() == 2)
+      return strtox_fast<uint16_t>(p, base, is_signed, negative, rc);
+  }
+
   do {
     if (rc.mul_overflow(base))
       goto overflow;
@@ -151,20 +219,7 @@ bool strtox_main(const char **p, char base, bool is_signed, bool negative,
   return false;
 
 overflow:
-  errno = ERANGE;
-
-  while (__parse_digit(**p, base) != -1)
-    ++(*p);
-
-  if (is_signed) {
-    if (negative)
-      rc.negative_limit();
-    else
-      rc.positive_limit();
-  } else {
-    rc.unsigned_limit();
-  }
-  return true;
+  return strtox_overflow(p, base, is_signed, negative, rc);
 }
 
 void strtox(const char *__restrict__ nptr, char **__restrict endptr, int base,
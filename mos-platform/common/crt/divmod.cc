@@ -1,21 +1,23 @@
 #include "divmod.h"
 
 extern "C" {
-char __udivqi3(char a, char b) { return udiv(a, b); }
+char __udivqi3(char a, char b) { return udiv<unsigned char>(a, b); }
 unsigned __udivhi3(unsigned a, unsigned b) { return udiv(a, b); }
 unsigned long __udivsi3(unsigned long a, unsigned long b) { return udiv(a, b); }
 unsigned long long __udivdi3(unsigned long long a, unsigned long long b) {
   return udiv(a, b);
 }
 
-char __umodqi3(char a, char b) { return umod(a, b); }
+char __umodqi3(char a, char b) { return umod<unsigned char>(a, b); }
 unsigned __umodhi3(unsigned a, unsigned b) { return umod(a, b); }
 unsigned long __umodsi3(unsigned long a, unsigned long b) { return umod(a, b); }
 unsigned long long __umoddi3(unsigned long long a, unsigned long long b) {
   return umod(a, b);
 }
 
-char __udivmodqi4(char a, char b, char *rem) { return udivmod(a, b, rem); }
+char __udivmodqi4(char a, char b, char *rem) {
+  return udivmod<unsigned char>(a, b, (unsigned char *)rem);
+}
 unsigned __udivmodhi4(unsigned a, unsigned b, unsigned *rem) {
   return udivmod(a, b, rem);
 }
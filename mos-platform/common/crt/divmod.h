@@ -1,81 +1,85 @@
 #ifndef __SLOW_DIV
 
-// Relatively straigtforward implementation of long division in C. Not
-// particularly tuned for performance, but clear.
-
-template <typename T> static inline T udiv(T a, T b) {
-  if (!b || b > a)
-    return 0;
-
-  // Here b <= a.
-
-  // Shift b as far left as possible without exceeding a. If the hightest bit of
-  // b is 1, then the next shift, if were performed at a higher bit width, would
-  // make it exceed a.
-  char num_digits_remaining = 0;
-  while (!(b & static_cast<T>(1) << (sizeof(T) * 8 - 1)) && (b << 1) <= a) {
-    b <<= 1;
-    ++num_digits_remaining;
+// Long division producing the quotient and remainder together. udiv and umod
+// are thin wrappers; when inlined, the unused half is dropped.
+//
+// Dividends are consumed a byte at a time from the most significant end,
+// which keeps the hot loops at 8 bits wherever possible:
+//  - An 8-bit divisor leaves a remainder that fits in a byte, so each
+//    dividend byte is one 16-by-8 step that yields one quotient byte.
+//  - A wider divisor can never divide the leading dividend bytes that are
+//    still below it, so those are moved into the remainder whole before
+//    restoring division handles the remaining bits.
+//  - 64-bit division drops to 32-bit arithmetic where the operands allow.
+//    The remainder is always below the divisor, so a 16- or 32-bit divisor
+//    only needs a remainder register of that width.
+
+// Divides hi:lo by d, where hi < d. Returns the quotient byte, and leaves the
+// remainder in hi. lo doubles as the quotient shift register.
+__attribute__((always_inline)) static inline unsigned char
+udivmod_byte(unsigned char &hi, unsigned char lo, unsigned char d) {
+  for (char i = 0; i < 8; ++i) {
+    bool carry = hi & 0x80;
+    hi = hi << 1 | lo >> 7;
+    lo <<= 1;
+    if (carry || hi >= d) {
+      hi -= d;
+      lo |= 1;
+    }
   }
+  return lo;
+}
 
-  // Since b <= a, the first digit is always 1. This is not counted in
-  // num_digits_remaining.
-  T q = 1;
-  a -= b;
-  b >>= 1;
-
-  for (; num_digits_remaining; --num_digits_remaining) {
-    // Prepare q to receive the next digit as its LSB.
-    q <<= 1;
-
-    // If the quotient digit is a 1
-    if (b <= a) {
-      q |= 1;
-
-      // Subtract out 1 * the divisor.
-      a -= b;
+template <typename T>
+static inline T udivmod_narrow(T a, unsigned char b, T *rem) {
+  unsigned char bytes[sizeof(T)];
+  __builtin_memcpy(bytes, &a, sizeof(T));
+  unsigned char r = 0;
+  for (signed char i = sizeof(T) - 1; i >= 0; --i) {
+    // A partial dividend below the divisor gives a zero quotient byte.
+    if (!r && bytes[i] < b) {
+      r = bytes[i];
+      bytes[i] = 0;
+      continue;
     }
-
-    // The next quotient digit corrsponds to one smaller power of 2 times the
-    // divisor.
-    b >>= 1;
+    bytes[i] = udivmod_byte(r, bytes[i], b);
   }
-
+  T q;
+  __builtin_memcpy(&q, bytes, sizeof(T));
+  *rem = r;
   return q;
 }
 
-template <typename T> static inline T umod(T a, T b) {
-  if (!b || b > a)
-    return a;
-
-  // Here b <= a.
-
-  // Shift b as far left as possible without exceeding a. If the hightest bit of
-  // b is 1, then the next shift, if were performed at a higher bit width, would
-  // make it exceed a.
-  char num_digits_remaining = 0;
-  while (!(b & static_cast<T>(1) << (sizeof(T) * 8 - 1)) && (b << 1) <= a) {
-    b <<= 1;
-    ++num_digits_remaining;
-  }
-
-  // Since b <= a, the first digit is always 1. This is not counted in
-  // num_digits_remaining.
-  a -= b;
-  b >>= 1;
-
-  for (; num_digits_remaining; --num_digits_remaining) {
-    // If the quotient digit is a 1
-    if (b <= a) {
-      // Subtract out 1 * the divisor.
-      a -= b;
+// Divides a by b, where b has more than 8 bits. R holds the remainder, so b
+// must fit in it.
+template <typename T, typename R>
+static inline T udivmod_wide(T a, R b, R *rem) {
+  constexpr char bits = sizeof(T) * 8;
+  constexpr char rbits = sizeof(R) * 8;
+
+  // Move leading dividend bytes into the remainder while it stays below the
+  // divisor. The divisor has more than 8 bits, so at least one byte moves.
+  R r = 0;
+  char remaining = bits;
+  do {
+    r = static_cast<R>(r << 8 | static_cast<R>(a >> (bits - 8)));
+    a <<= 8;
+    remaining -= 8;
+  } while (remaining && !(r >> (rbits - 8)) &&
+           static_cast<R>(r << 8 | static_cast<R>(a >> (bits - 8))) < b);
+
+  // Restoring division on the rest, shifting quotient bits into a as the
+  // dividend bits shift out.
+  for (; remaining; --remaining) {
+    bool carry = r >> (rbits - 1);
+    r = static_cast<R>(r << 1 | static_cast<R>(a >> (bits - 1)));
+    a <<= 1;
+    if (carry || r >= b) {
+      r -= b;
+      a |= 1;
     }
-
-    // The next quotient digit corrsponds to one smaller power of 2 times the
-    // divisor.
-    b >>= 1;
   }
-
+  *rem = r;
   return a;
 }
 
@@ -84,43 +88,37 @@ template <typename T> static inline T udivmod(T a, T b, T *rem) {
     *rem = a;
     return 0;
   }
-
-  // Here b <= a.
-
-  // Shift b as far left as possible without exceeding a. If the hightest bit of
-  // b is 1, then the next shift, if were performed at a higher bit width, would
-  // make it exceed a.
-  char num_digits_remaining = 0;
-  while (!(b & static_cast<T>(1) << (sizeof(T) * 8 - 1)) && (b << 1) <= a) {
-    b <<= 1;
-    ++num_digits_remaining;
-  }
-
-  // Since b <= a, the first digit is always 1. This is not counted in
-  // num_digits_remaining.
-  T q = 1;
-  a -= b;
-  b >>= 1;
-
-  for (; num_digits_remaining; --num_digits_remaining) {
-    // Prepare q to receive the next digit as its LSB.
-    q <<= 1;
-
-    // If the quotient digit is a 1
-    if (b <= a) {
-      q |= 1;
-
-      // Subtract out 1 * the divisor.
-      a -= b;
+  if (sizeof(T) == 1 || !(b >> 8))
+    return udivmod_narrow(a, static_cast<unsigned char>(b), rem);
+  if constexpr (sizeof(T) == 8) {
+    unsigned long r;
+    T q;
+    if (!(a >> 32)) {
+      q = udivmod_wide<unsigned long, unsigned long>(a, b, &r);
+    } else if (!(b >> 16)) {
+      unsigned r16;
+      q = udivmod_wide<T, unsigned>(a, b, &r16);
+      r = r16;
+    } else if (!(b >> 32)) {
+      q = udivmod_wide<T, unsigned long>(a, b, &r);
+    } else {
+      return udivmod_wide(a, b, rem);
     }
-
-    // The next quotient digit corrsponds to one smaller power of 2 times the
-    // divisor.
-    b >>= 1;
+    *rem = r;
+    return q;
   }
+  return udivmod_wide(a, b, rem);
+}
 
-  *rem = a;
-  return q;
+template <typename T> static inline T udiv(T a, T b) {
+  T rem;
+  return udivmod(a, b, &rem);
+}
+
+template <typename T> static inline T umod(T a, T b) {
+  T rem;
+  udivmod(a, b, &rem);
+  return rem;
 }
 
 #else // __SLOW_DIV
@@ -148,7 +146,7 @@ template <typename T> static inline T umod(T a, T b) {
 
 template <typename T> struct make_unsigned;
 template <> struct make_unsigned<signed char> {
-  typedef char type;
+  typedef unsigned char type;
 };
 template <> struct make_unsigned<int> {
   typedef unsigned type;
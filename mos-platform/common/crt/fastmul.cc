@@ -0,0 +1,138 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Quarter-square multiplication. Every product here is built from 8x8 bit
+// products, each of which is two table lookups and a subtraction:
+//   a * b = f(a + b) - f(|a - b|), where f(x) = floor(x^2 / 4).
+// The floors cancel, since a + b and a - b are both even or both odd.
+//
+// Nothing in this file may use `*` on integers, since that would recurse into
+// the libcalls it defines.
+
+#include <fastmul.h>
+
+namespace {
+
+// f(x) for x in [0, 511], split into low and high bytes so that each lookup is
+// a single indexed load. Page alignment keeps those loads from paying for page
+// crossings.
+struct SquareTables {
+  uint8_t lo[512];
+  uint8_t hi[512];
+
+  constexpr SquareTables() : lo(), hi() {
+    for (uint32_t x = 0; x < 512; ++x) {
+      uint16_t f = x * x / 4;
+      lo[x] = f & 0xff;
+      hi[x] = f >> 8;
+    }
+  }
+};
+
+alignas(256) constexpr SquareTables squares;
+
+__attribute__((always_inline)) inline uint8_t absdiff(uint8_t a, uint8_t b) {
+  return a >= b ? a - b : b - a;
+}
+
+// Low byte of a * b.
+__attribute__((always_inline)) inline uint8_t mul8_lo(uint8_t a, uint8_t b) {
+  return squares.lo[a + b] - squares.lo[absdiff(a, b)];
+}
+
+__attribute__((always_inline)) inline uint16_t square(uint16_t x) {
+  return squares.lo[x] | static_cast<uint16_t>(squares.hi[x]) << 8;
+}
+
+__attribute__((always_inline)) inline uint16_t mul8(uint8_t a, uint8_t b) {
+  return square(a + b) - square(absdiff(a, b));
+}
+
+// Low 16 bits of a * b. Only the low bytes of the cross terms reach the
+// result.
+inline uint16_t mul16_lo(uint16_t a, uint16_t b) {
+  uint8_t al = a, ah = a >> 8, bl = b, bh = b >> 8;
+  if (!(ah | bh))
+    return mul8(al, bl);
+  uint8_t mid = mul8_lo(al, bh) + mul8_lo(ah, bl);
+  return mul8(al, bl) + (static_cast<uint16_t>(mid) << 8);
+}
+
+inline uint32_t mul16(uint16_t a, uint16_t b) {
+  uint8_t al = a, ah = a >> 8, bl = b, bh = b >> 8;
+  if (!(ah | bh))
+    return mul8(al, bl);
+  uint32_t result = mul8(al, bl) | static_cast<uint32_t>(mul8(ah, bh)) << 16;
+  uint32_t mid = static_cast<uint32_t>(mul8(al, bh)) + mul8(ah, bl);
+  return result + (mid << 8);
+}
+
+// Low 32 bits of a * b.
+inline uint32_t mul32_lo(uint32_t a, uint32_t b) {
+  uint16_t al = a, ah = a >> 16, bl = b, bh = b >> 16;
+  if (!(ah | bh))
+    return mul16(al, bl);
+  uint16_t mid = mul16_lo(al, bh) + mul16_lo(ah, bl);
+  return mul16(al, bl) + (static_cast<uint32_t>(mid) << 16);
+}
+
+inline uint64_t mul32(uint32_t a, uint32_t b) {
+  uint16_t al = a, ah = a >> 16, bl = b, bh = b >> 16;
+  if (!(ah | bh))
+    return mul16(al, bl);
+  uint64_t result = mul16(al, bl) | static_cast<uint64_t>(mul16(ah, bh)) << 32;
+  uint64_t mid = static_cast<uint64_t>(mul16(al, bh)) + mul16(ah, bl);
+  return result + (mid << 16);
+}
+
+// Low 64 bits of a * b.
+inline uint64_t mul64_lo(uint64_t a, uint64_t b) {
+  uint32_t al = a, ah = a >> 32, bl = b, bh = b >> 32;
+  if (!(ah | bh))
+    return mul32(al, bl);
+  uint32_t mid = mul32_lo(al, bh) + mul32_lo(ah, bl);
+  return mul32(al, bl) + (static_cast<uint64_t>(mid) << 32);
+}
+
+} // namespace
+
+extern "C" {
+
+uint16_t fastmul_u8x8(uint8_t a, uint8_t b) { return mul8(a, b); }
+
+// Two's complement correction: reading a negative operand as unsigned adds
+// 2^8 times the other operand to the product.
+int16_t fastmul_s8x8(int8_t a, int8_t b) {
+  uint16_t p = mul8(a, b);
+  if (a < 0)
+    p -= static_cast<uint16_t>(static_cast<uint8_t>(b)) << 8;
+  if (b < 0)
+    p -= static_cast<uint16_t>(static_cast<uint8_t>(a)) << 8;
+  return p;
+}
+
+uint32_t fastmul_u16x16(uint16_t a, uint16_t b) { return mul16(a, b); }
+
+int32_t fastmul_s16x16(int16_t a, int16_t b) {
+  uint32_t p = mul16(a, b);
+  if (a < 0)
+    p -= static_cast<uint32_t>(static_cast<uint16_t>(b)) << 16;
+  if (b < 0)
+    p -= static_cast<uint32_t>(static_cast<uint16_t>(a)) << 16;
+  return p;
+}
+
+char __mulqi3(char a, char b) { return mul8_lo(a, b); }
+
+unsigned __mulhi3(unsigned a, unsigned b) { return mul16_lo(a, b); }
+
+unsigned long __mulsi3(unsigned long a, unsigned long b) {
+  return mul32_lo(a, b);
+}
+
+unsigned long long __muldi3(unsigned long long a, unsigned long long b) {
+  return mul64_lo(a, b);
+}
+}
@@ -9,6 +9,41 @@ template <typename T> static inline T mul(T a, T b) {
   return result;
 }
 
+// Schoolbook multiplication a byte at a time. Only the byte products that land
+// in the low sizeof(T) bytes are formed, zero multiplier bytes are skipped, and
+// the multiplicand's leading zero bytes are never visited. Each byte product
+// is the loop above with an 8-bit multiplier, so it runs at most eight times.
+template <typename T> static inline T mul_bytes(T a, T b) {
+  unsigned char ab[sizeof(T)], bb[sizeof(T)], rb[sizeof(T)] = {};
+  __builtin_memcpy(ab, &a, sizeof(T));
+  __builtin_memcpy(bb, &b, sizeof(T));
+
+  char na = sizeof(T);
+  while (na && !ab[na - 1])
+    --na;
+
+  for (char i = 0; i < (char)sizeof(T); ++i) {
+    unsigned char bi = bb[i];
+    if (!bi)
+      continue;
+    // Each step is at most 0xff * 0xff + 0xff + 0xff, so it fits in 16 bits.
+    unsigned carry = 0;
+    char j = 0;
+    for (; j < na && i + j < (char)sizeof(T); ++j) {
+      unsigned p = mul<unsigned>(ab[j], bi) + rb[i + j] + carry;
+      rb[i + j] = p;
+      carry = p >> 8;
+    }
+    // Earlier rows end below this byte, so it's still zero.
+    if (i + j < (char)sizeof(T))
+      rb[i + j] = carry;
+  }
+
+  T result;
+  __builtin_memcpy(&result, rb, sizeof(T));
+  return result;
+}
+
 extern "C" {
 
 char __mulqi3(char a, char b) { return mul(a, b); }
@@ -18,6 +53,6 @@ unsigned __mulhi3(unsigned a, unsigned b) { return mul(a, b); }
 unsigned long __mulsi3(unsigned long a, unsigned long b) { return mul(a, b); }
 
 unsigned long long __muldi3(unsigned long long a, unsigned long long b) {
-  return mul(a, b);
+  return mul_bytes(a, b);
 }
 }
@@ -1,10 +1,19 @@
+// Whole bytes are rotated by moving bytes, which leaves at most seven
+// single-bit rounds.
+
 template <typename T> static inline T rotl(T n, char amt) {
+  if constexpr (sizeof(T) > 1)
+    for (; amt >= 8; amt -= 8)
+      n = n << 8 | n >> (sizeof(T) * 8 - 8);
   while (amt--)
     n = n << 1 | n >> (sizeof(T) * 8 - 1);
   return n;
 }
 
 template <typename T> static inline T rotr(T n, char amt) {
+  if constexpr (sizeof(T) > 1)
+    for (; amt >= 8; amt -= 8)
+      n = n >> 8 | n << (sizeof(T) * 8 - 8);
   while (amt--)
     n = n >> 1 | n << (sizeof(T) * 8 - 1);
   return n;
@@ -1,32 +1,67 @@
-template <typename T> static inline T shl(T n, char amt) {
+// Variable shifts first move whole bytes, then shift the remaining bits one at
+// a time. Each byte moved narrows the working type by a byte, so the bit loop
+// runs at most seven times, and only over the bytes that can still change.
+
+template <unsigned Bits, bool Signed> struct IntOf {
+  using type = unsigned _BitInt(Bits);
+};
+template <unsigned Bits> struct IntOf<Bits, true> {
+  using type = _BitInt(Bits);
+};
+template <unsigned Bits, bool Signed>
+using Int = typename IntOf<Bits, Signed>::type;
+
+template <unsigned Bits>
+static inline Int<Bits, false> shl(Int<Bits, false> n, char amt) {
+  if constexpr (Bits > 8) {
+    // The low byte becomes zero; the high byte is shifted out entirely.
+    if (amt >= 8)
+      return (Int<Bits, false>)shl<Bits - 8>((Int<Bits - 8, false>)n,
+                                             amt - 8)
+             << 8;
+  }
   while (amt--)
     n <<= 1;
   return n;
 }
 
-template <typename T> static inline T shr(T n, char amt) {
+template <unsigned Bits, bool Signed>
+static inline Int<Bits, Signed> shr(Int<Bits, Signed> n, char amt) {
+  if constexpr (Bits > 8) {
+    // The high byte becomes zero (or sign); extending the narrower result
+    // fills it back in.
+    if (amt >= 8)
+      return (Int<Bits, Signed>)shr<Bits - 8, Signed>(
+          (Int<Bits - 8, Signed>)(n >> 8), amt - 8);
+  }
   while (amt--)
     n >>= 1;
   return n;
 }
 
 extern "C" {
-char __ashlqi3(char n, char amt) { return shl(n, amt); }
-unsigned int __ashlhi3(unsigned int n, char amt) { return shl(n, amt); }
-unsigned long __ashlsi3(unsigned long n, char amt) { return shl(n, amt); }
+char __ashlqi3(char n, char amt) { return shl<8>(n, amt); }
+unsigned int __ashlhi3(unsigned int n, char amt) { return shl<16>(n, amt); }
+unsigned long __ashlsi3(unsigned long n, char amt) { return shl<32>(n, amt); }
 unsigned long long __ashldi3(unsigned long long n, char amt) {
-  return shl(n, amt);
+  return shl<64>(n, amt);
 }
 
-char __lshrqi3(char n, char amt) { return shr(n, amt); }
-unsigned int __lshrhi3(unsigned int n, char amt) { return shr(n, amt); }
-unsigned long __lshrsi3(unsigned long n, char amt) { return shr(n, amt); }
+char __lshrqi3(char n, char amt) { return shr<8, false>(n, amt); }
+unsigned int __lshrhi3(unsigned int n, char amt) {
+  return shr<16, false>(n, amt);
+}
+unsigned long __lshrsi3(unsigned long n, char amt) {
+  return shr<32, false>(n, amt);
+}
 unsigned long long __lshrdi3(unsigned long long n, char amt) {
-  return shr(n, amt);
+  return shr<64, false>(n, amt);
 }
 
-signed char __ashrqi3(signed char n, char amt) { return shr(n, amt); }
-int __ashrhi3(int n, char amt) { return shr(n, amt); }
-long __ashrsi3(long n, char amt) { return shr(n, amt); }
-long long __ashrdi3(long long n, char amt) { return shr(n, amt); }
+signed char __ashrqi3(signed char n, char amt) {
+  return shr<8, true>(n, amt);
+}
+int __ashrhi3(int n, char amt) { return shr<16, true>(n, amt); }
+long __ashrsi3(long n, char amt) { return shr<32, true>(n, amt); }
+long long __ashrdi3(long long n, char amt) { return shr<64, true>(n, amt); }
 }
@@ -6,4 +6,19 @@
 #define _SYMBOL_TO_STRING(x) #x
 #define _VALUE_TO_STRING(x) _SYMBOL_TO_STRING(x)
 
+// Expands to a 256-element initializer whose element i is (char)F(i). Used to
+// build character translation tables at compile time from a mapping macro.
+#define _CHAR_TABLE16(F, i)                                                    \
+  (char)F(i), (char)F(i + 1), (char)F(i + 2), (char)F(i + 3), (char)F(i + 4),  \
+      (char)F(i + 5), (char)F(i + 6), (char)F(i + 7), (char)F(i + 8),          \
+      (char)F(i + 9), (char)F(i + 10), (char)F(i + 11), (char)F(i + 12),       \
+      (char)F(i + 13), (char)F(i + 14), (char)F(i + 15)
+#define _CHAR_TABLE(F)                                                         \
+  _CHAR_TABLE16(F, 0x00), _CHAR_TABLE16(F, 0x10), _CHAR_TABLE16(F, 0x20),      \
+      _CHAR_TABLE16(F, 0x30), _CHAR_TABLE16(F, 0x40), _CHAR_TABLE16(F, 0x50),  \
+      _CHAR_TABLE16(F, 0x60), _CHAR_TABLE16(F, 0x70), _CHAR_TABLE16(F, 0x80),  \
+      _CHAR_TABLE16(F, 0x90), _CHAR_TABLE16(F, 0xa0), _CHAR_TABLE16(F, 0xb0),  \
+      _CHAR_TABLE16(F, 0xc0), _CHAR_TABLE16(F, 0xd0), _CHAR_TABLE16(F, 0xe0),  \
+      _CHAR_TABLE16(F, 0xf0)
+
 #endif // not __INTERNAL_H_
@@ -0,0 +1,706 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _COMPILED_PRINTF_H
+#define _COMPILED_PRINTF_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdio.h>
+#include <string.h>
+#include <type_traits>
+
+/// Compile-time parsed printf.
+///
+/// The C printf family parses its format string at run time, fetches its
+/// arguments through varargs, and hands every output character to a callback.
+/// For hot paths like logging or drawing HUD text, that overhead usually
+/// dwarfs the conversions themselves.
+///
+/// The functions in this namespace take the format string as a compile-time
+/// constant instead. The string is parsed entirely during compilation into a
+/// fixed sequence of calls: one bulk write for each run of literal text, and
+/// one typed conversion for each argument. Arguments keep their C++ types, so
+/// no length modifiers are needed (they are accepted and ignored), and the
+/// argument count and kinds are checked with static_assert. Floating point
+/// support is only instantiated if a format actually contains `%f`.
+///
+/// The supported syntax is `%[flags][width][.precision][length]conversion`,
+/// where flags are any of `-+ 0#`, and conversion is one of `d i u o x X c s p
+/// f %`. Widths and precisions must be literal numbers; `*` is not supported.
+///
+/// In C++20 the format can be given directly as a template argument:
+///
+///     cprintf::print<"X=%d Y=%d\n">(x, y);
+///
+/// In C++17, wrap the format string with the CPRINTF_FORMAT macro instead:
+///
+///     cprintf::print(CPRINTF_FORMAT("X=%d Y=%d\n"), x, y);
+///
+/// The `%f` conversion is correctly rounded, as with printf, for magnitudes
+/// below 2^64. Larger values print their leading 18 or 19 digits, rounded once
+/// from the exact value, and the rest as zeros. The precision may be at most 9,
+/// and widths may be at most 255.
+namespace cprintf {
+
+/// Destination of formatted output: either a stdio stream or a character
+/// buffer of a fixed size. Literal runs and converted digit strings are passed
+/// along in bulk.
+class Output {
+  FILE *stream_;
+  char *s_;
+  size_t n_;
+  size_t i_ = 0;
+
+public:
+  explicit Output(FILE *stream) : stream_(stream), s_(nullptr), n_(0) {}
+  Output(char *s, size_t n) : stream_(nullptr), s_(s), n_(n) {}
+
+  /// Number of characters that would have been written given enough space.
+  size_t count() const { return i_; }
+
+  void put(char c) {
+    if (stream_)
+      putc(c, stream_);
+    else if (i_ < n_)
+      s_[i_] = c;
+    ++i_;
+  }
+
+  void write(const char *s, size_t len) {
+    if (stream_) {
+      fwrite(s, 1, len, stream_);
+    } else if (i_ < n_) {
+      size_t avail = n_ - i_;
+      memcpy(s_ + i_, s, len < avail ? len : avail);
+    }
+    i_ += len;
+  }
+
+  void fill(char c, size_t len) {
+    while (len--)
+      put(c);
+  }
+
+  /// Null-terminates buffer output, truncating if needed.
+  void finish() {
+    if (!stream_ && n_)
+      s_[i_ < n_ ? i_ : n_ - 1] = '\0';
+  }
+};
+
+namespace __impl {
+
+enum : uint8_t {
+  F_MINUS = 1 << 0,
+  F_PLUS = 1 << 1,
+  F_SPACE = 1 << 2,
+  F_ZERO = 1 << 3,
+  F_ALT = 1 << 4,
+};
+
+/// A fully parsed conversion specification.
+struct Spec {
+  uint8_t flags;
+  uint8_t width;
+  int8_t prec; // -1 if not given
+  char conv;
+  size_t end;     // Index just past the specification.
+  bool too_large; // The width or precision does not fit its field.
+};
+
+constexpr size_t find_spec(const char *s, size_t pos) {
+  while (s[pos] && s[pos] != '%')
+    ++pos;
+  return pos;
+}
+
+constexpr Spec parse_spec(const char *s, size_t pos) {
+  Spec spec = {0, 0, -1, 0, 0, false};
+  ++pos; // '%'
+
+  for (bool more = true; more;) {
+    switch (s[pos]) {
+    case '-':
+      spec.flags |= F_MINUS;
+      break;
+    case '+':
+      spec.flags |= F_PLUS;
+      break;
+    case ' ':
+      spec.flags |= F_SPACE;
+      break;
+    case '0':
+      spec.flags |= F_ZERO;
+      break;
+    case '#':
+      spec.flags |= F_ALT;
+      break;
+    default:
+      more = false;
+      continue;
+    }
+    ++pos;
+  }
+
+  // Accumulate wider than the fields, saturating, to catch overflow.
+  unsigned width = 0;
+  for (; '0' <= s[pos] && s[pos] <= '9'; ++pos)
+    width = width > 255 ? width : width * 10 + (s[pos] - '0');
+  spec.width = width;
+  spec.too_large = width > 255;
+
+  if (s[pos] == '.') {
+    unsigned prec = 0;
+    for (++pos; '0' <= s[pos] && s[pos] <= '9'; ++pos)
+      prec = prec > 127 ? prec : prec * 10 + (s[pos] - '0');
+    spec.prec = prec;
+    spec.too_large |= prec > 127;
+  }
+
+  // Length modifiers carry no information; the argument types do.
+  while (s[pos] == 'h' || s[pos] == 'l' || s[pos] == 'j' || s[pos] == 'z' ||
+         s[pos] == 't' || s[pos] == 'L')
+    ++pos;
+
+  spec.conv = s[pos];
+  spec.end = s[pos] ? pos + 1 : pos;
+  return spec;
+}
+
+/// Digits of a converted number, most significant first. Leading zeros are
+/// never stored, so zero has no digits.
+struct Digits {
+  char buf[22];
+  uint8_t n = 0;
+
+  void digit(char d) {
+    if (d || n)
+      buf[n++] = d;
+  }
+};
+
+// Decimal digits are peeled off by repeated subtraction of powers of ten,
+// narrowing the working type as soon as the remainder fits.
+
+template <typename T> inline T dec_digit(T value, T pow, Digits &d) {
+  char digit = 0;
+  while (value >= pow) {
+    value -= pow;
+    ++digit;
+  }
+  d.digit(digit);
+  return value;
+}
+
+inline void dec_lt100(uint8_t v, Digits &d) {
+  v = dec_digit<uint8_t>(v, 10, d);
+  d.digit(v);
+}
+
+inline void dec_lt10000(uint16_t v, Digits &d) {
+  v = dec_digit<uint16_t>(v, 1000, d);
+  v = dec_digit<uint16_t>(v, 100, d);
+  dec_lt100(v, d);
+}
+
+inline constexpr uint32_t pow10_32[] = {100000000ul, 10000000ul, 1000000ul,
+                                        100000ul, 10000ul};
+
+inline constexpr uint64_t pow10_64[] = {
+    10000000000000000000ull, 1000000000000000000ull, 100000000000000000ull,
+    10000000000000000ull,    1000000000000000ull,    100000000000000ull,
+    10000000000000ull,       1000000000000ull,       100000000000ull,
+    10000000000ull,          1000000000ull};
+
+inline void dec_lt1e9(uint32_t v, Digits &d) {
+  for (uint32_t pow : pow10_32)
+    v = dec_digit(v, pow, d);
+  dec_lt10000(v, d);
+}
+
+inline void dec(uint8_t v, Digits &d) {
+  dec_lt100(dec_digit<uint8_t>(v, 100, d), d);
+}
+
+inline void dec(uint16_t v, Digits &d) {
+  dec_lt10000(dec_digit<uint16_t>(v, 10000, d), d);
+}
+
+inline void dec(uint32_t v, Digits &d) {
+  dec_lt1e9(dec_digit<uint32_t>(v, 1000000000ul, d), d);
+}
+
+inline void dec(uint64_t v, Digits &d) {
+  for (uint64_t pow : pow10_64)
+    v = dec_digit(v, pow, d);
+  dec_lt1e9(static_cast<uint32_t>(v), d);
+}
+
+// Hex digits are the nibbles of the value, most significant byte first.
+template <typename T> inline void hex(T v, Digits &d) {
+  const auto *bytes = reinterpret_cast<const uint8_t *>(&v);
+  for (uint8_t i = sizeof(T); i--;) {
+    d.digit(bytes[i] >> 4);
+    d.digit(bytes[i] & 0xf);
+  }
+}
+
+template <typename T> inline void oct(T v, Digits &d) {
+  char rev[sizeof(T) * 8 / 3 + 1];
+  uint8_t n = 0;
+  for (; v; v >>= 3)
+    rev[n++] = v & 7;
+  while (n)
+    d.digit(rev[--n]);
+}
+
+inline char digit_char(char d, bool upper) {
+  if (d <= 9)
+    return '0' + d;
+  return (upper ? 'A' : 'a') + (d - 10);
+}
+
+/// Emits digits with the prefix, precision, and field width padding of spec.
+inline void emit_digits(Output &out, Digits &d, const char *prefix,
+                        uint8_t prefix_len, Spec spec) {
+  uint8_t prec = spec.prec < 0 ? 1 : spec.prec;
+  // Having a precision cancels out any zero flag.
+  if (spec.prec >= 0)
+    spec.flags &= ~F_ZERO;
+  if (spec.flags & F_ALT && spec.conv == 'o' && prec <= d.n)
+    prec = d.n + 1;
+  uint8_t zeros = prec > d.n ? prec - d.n : 0;
+
+  size_t len = prefix_len + zeros + d.n;
+  size_t padding = spec.width > len ? spec.width - len : 0;
+
+  if (!(spec.flags & (F_MINUS | F_ZERO)))
+    out.fill(' ', padding);
+  out.write(prefix, prefix_len);
+  if (spec.flags & F_ZERO && !(spec.flags & F_MINUS))
+    out.fill('0', padding);
+  out.fill('0', zeros);
+
+  bool upper = spec.conv == 'X';
+  for (uint8_t i = 0; i < d.n; ++i)
+    d.buf[i] = digit_char(d.buf[i], upper);
+  out.write(d.buf, d.n);
+
+  if (spec.flags & F_MINUS)
+    out.fill(' ', padding);
+}
+
+/// Picks the fixed-width unsigned type used to convert an integer argument.
+template <typename T>
+using UInt = std::conditional_t<
+    sizeof(T) == 1, uint8_t,
+    std::conditional_t<sizeof(T) == 2, uint16_t,
+                       std::conditional_t<sizeof(T) <= 4, uint32_t,
+                                          uint64_t>>>;
+
+template <typename T> inline void emit_int(Output &out, T value, Spec spec) {
+  using U = UInt<T>;
+  U u = static_cast<U>(value);
+
+  char prefix[2];
+  uint8_t prefix_len = 0;
+  Digits d;
+
+  if (spec.conv == 'd' || spec.conv == 'i') {
+    if constexpr (std::is_signed_v<T>) {
+      if (value < 0) {
+        u = static_cast<U>(-u);
+        prefix[prefix_len++] = '-';
+      }
+    }
+    if (!prefix_len) {
+      if (spec.flags & F_PLUS)
+        prefix[prefix_len++] = '+';
+      else if (spec.flags & F_SPACE)
+        prefix[prefix_len++] = ' ';
+    }
+    dec(u, d);
+  } else if (spec.conv == 'u') {
+    dec(u, d);
+  } else if (spec.conv == 'o') {
+    oct(u, d);
+  } else {
+    hex(u, d);
+    if (spec.flags & F_ALT && d.n) {
+      prefix[prefix_len++] = '0';
+      prefix[prefix_len++] = spec.conv == 'X' ? 'X' : 'x';
+    }
+  }
+  emit_digits(out, d, prefix, prefix_len, spec);
+}
+
+inline void emit_string(Output &out, const char *s, Spec spec) {
+  size_t len = 0;
+  while ((spec.prec < 0 || len < (size_t)spec.prec) && s[len])
+    ++len;
+  size_t padding = spec.width > len ? spec.width - len : 0;
+  if (!(spec.flags & F_MINUS))
+    out.fill(' ', padding);
+  out.write(s, len);
+  if (spec.flags & F_MINUS)
+    out.fill(' ', padding);
+}
+
+template <typename T>
+using FloatBits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+// Decomposes a finite, non-negative value into mant * 2^-shift.
+template <typename T>
+inline int16_t float_parts(T value, FloatBits<T> &mant) {
+  using Bits = FloatBits<T>;
+  constexpr uint8_t mant_bits = sizeof(T) == 4 ? 23 : 52;
+  constexpr int16_t bias = sizeof(T) == 4 ? 127 : 1023;
+
+  Bits bits = __builtin_bit_cast(Bits, value);
+  mant = bits & ((Bits(1) << mant_bits) - 1);
+  int16_t exp = bits >> mant_bits;
+  if (exp)
+    mant |= Bits(1) << mant_bits;
+  else
+    exp = 1;
+  return bias + mant_bits - exp;
+}
+
+// Splits a finite, non-negative value below 2^64 into its whole part and its
+// fractional part times scale. The fraction is rounded once, half to even,
+// from the exact binary value, so e.g. 0.05f (really 0.0500000007...) gives
+// 0.1 at one digit, as printf does.
+template <typename T>
+inline void split_float(T value, uint32_t scale, uint64_t &whole,
+                        uint32_t &frac) {
+  using Bits = FloatBits<T>;
+  // Wide enough for the fraction bits times a scale below 2^30.
+  using Wide =
+      std::conditional_t<sizeof(T) == 4, uint64_t, unsigned _BitInt(128)>;
+  constexpr uint8_t mant_bits = sizeof(T) == 4 ? 23 : 52;
+
+  Bits mant;
+  int16_t shift = float_parts(value, mant);
+  frac = 0;
+  if (shift <= 0) {
+    whole = uint64_t(mant) << -shift;
+    return;
+  }
+  whole = 0;
+  Bits frac_bits = mant;
+  if (shift < int16_t(sizeof(Bits) * 8)) {
+    whole = mant >> shift;
+    frac_bits = mant & ((Bits(1) << shift) - 1);
+  }
+
+  // Past this shift, the scaled fraction is below one half.
+  if (shift > mant_bits + 31)
+    return;
+  Wide p = Wide(frac_bits) * scale;
+  frac = static_cast<uint32_t>(p >> shift);
+  Wide rem = p - (Wide(frac) << shift);
+  Wide half = Wide(1) << (shift - 1);
+  // With no fractional digits, the last digit belongs to the whole part.
+  bool odd = scale > 1 ? frac & 1 : whole & 1;
+  if (rem > half || (rem == half && odd))
+    ++frac;
+  if (frac >= scale) {
+    frac -= scale;
+    ++whole;
+  }
+}
+
+// Reduces a finite value of at least 2^64 to a quotient below 2^63 and a count
+// of decimal zeros to follow it. The exact integer value is divided down in
+// 16-bit limbs, and the quotient rounded once, half to even.
+template <typename T> inline uint64_t scale_huge(T value, uint16_t &zeros) {
+  using Bits = FloatBits<T>;
+  constexpr uint8_t limbs = sizeof(T) == 4 ? 128 / 16 : 1024 / 16;
+
+  Bits mant;
+  int16_t e = -float_parts(value, mant);
+  uint16_t n[limbs];
+  uint8_t top = 0;
+  for (uint8_t i = 0; i < limbs; ++i) {
+    // The bit of the mantissa that lands in bit 0 of this limb.
+    int16_t off = int16_t(i * 16) - e;
+    Bits v = 0;
+    if (off >= 0 && off < int16_t(sizeof(Bits) * 8))
+      v = mant >> off;
+    else if (off < 0 && off > -16)
+      v = mant << -off;
+    n[i] = static_cast<uint16_t>(v);
+    if (n[i])
+      top = i;
+  }
+
+  // Divides the limbs in place, returning the remainder.
+  auto div = [&](uint16_t d) {
+    uint32_t r = 0;
+    for (uint8_t i = top + 1; i--;) {
+      uint32_t cur = r << 16 | n[i];
+      n[i] = cur / d;
+      r = cur % d;
+    }
+    if (!n[top])
+      --top;
+    return static_cast<uint16_t>(r);
+  };
+
+  // The most significant digit removed, and whether any other was nonzero.
+  uint8_t round = 0;
+  bool sticky = false;
+  zeros = 0;
+  // Four digits at a time while the quotient stays at least 2^64.
+  while (top >= 5) {
+    uint16_t r = div(10000);
+    sticky |= round || r % 1000;
+    round = r / 1000;
+    zeros += 4;
+  }
+  while (top >= 4 || n[3] & 0x8000) {
+    uint16_t r = div(10);
+    sticky |= round;
+    round = r;
+    ++zeros;
+  }
+
+  uint64_t q = 0;
+  for (uint8_t i = 4; i--;)
+    q = q << 16 | n[i];
+  if (round > 5 || (round == 5 && (sticky || q & 1)))
+    ++q;
+  return q;
+}
+
+template <typename T> inline void emit_float(Output &out, T value, Spec spec) {
+  uint8_t prec = spec.prec < 0 ? 6 : spec.prec;
+
+  char prefix[1];
+  uint8_t prefix_len = 0;
+  // Test the sign bit rather than comparing, so that -0.0 keeps its sign.
+  if (__builtin_signbit(value)) {
+    value = -value;
+    prefix[prefix_len++] = '-';
+  } else if (spec.flags & F_PLUS) {
+    prefix[prefix_len++] = '+';
+  } else if (spec.flags & F_SPACE) {
+    prefix[prefix_len++] = ' ';
+  }
+
+  if (value != value || value - value != 0) {
+    char str[5];
+    memcpy(str, prefix, prefix_len);
+    memcpy(str + prefix_len, value != value ? "nan" : "inf", 4);
+    Spec s = spec;
+    s.prec = -1;
+    emit_string(out, str, s);
+    return;
+  }
+
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < prec; ++i)
+    scale *= 10;
+  uint64_t whole;
+  uint32_t frac = 0;
+  // Values too large for 64 bits are integers; they print as their leading
+  // digits followed by zeros.
+  uint16_t int_zeros = 0;
+  if (value >= T(18446744073709551616.0))
+    whole = scale_huge(value, int_zeros);
+  else
+    split_float(value, scale, whole, frac);
+
+  Digits w;
+  if (whole >> 32)
+    dec(whole, w);
+  else
+    dec(static_cast<uint32_t>(whole), w);
+  if (!w.n)
+    w.buf[w.n++] = 0;
+  for (uint8_t i = 0; i < w.n; ++i)
+    w.buf[i] += '0';
+
+  Digits f;
+  dec(frac, f);
+  uint8_t frac_zeros = prec - f.n;
+  for (uint8_t i = 0; i < f.n; ++i)
+    f.buf[i] += '0';
+
+  bool has_point = prec || spec.flags & F_ALT;
+  size_t len = prefix_len + w.n + int_zeros + has_point + prec;
+  size_t padding = spec.width > len ? spec.width - len : 0;
+
+  if (!(spec.flags & (F_MINUS | F_ZERO)))
+    out.fill(' ', padding);
+  out.write(prefix, prefix_len);
+  if (spec.flags & F_ZERO && !(spec.flags & F_MINUS))
+    out.fill('0', padding);
+  out.write(w.buf, w.n);
+  out.fill('0', int_zeros);
+  if (has_point)
+    out.put('.');
+  out.fill('0', frac_zeros);
+  out.write(f.buf, f.n);
+  if (spec.flags & F_MINUS)
+    out.fill(' ', padding);
+}
+
+/// Emits one conversion of an argument, chosen entirely at compile time.
+template <typename Fmt, size_t Pos, typename T>
+inline void convert(Output &out, const T &arg) {
+  constexpr Spec spec = parse_spec(Fmt::str(), Pos);
+  constexpr char c = spec.conv;
+  static_assert(!spec.too_large,
+                "width may be at most 255 and precision at most 127");
+
+  if constexpr (c == 'd' || c == 'i' || c == 'u' || c == 'o' || c == 'x' ||
+                c == 'X') {
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>,
+                  "integer conversion requires an integer argument");
+    if constexpr (std::is_enum_v<T>)
+      emit_int(out, static_cast<std::underlying_type_t<T>>(arg), spec);
+    else
+      emit_int(out, arg, spec);
+  } else if constexpr (c == 'c') {
+    static_assert(std::is_integral_v<T>, "%c requires an integer argument");
+    size_t padding = spec.width > 1 ? spec.width - 1 : 0;
+    if (!(spec.flags & F_MINUS))
+      out.fill(' ', padding);
+    out.put(static_cast<char>(arg));
+    if (spec.flags & F_MINUS)
+      out.fill(' ', padding);
+  } else if constexpr (c == 's') {
+    static_assert(std::is_convertible_v<T, const char *>,
+                  "%s requires a string argument");
+    emit_string(out, arg, spec);
+  } else if constexpr (c == 'p') {
+    static_assert(std::is_pointer_v<T>, "%p requires a pointer argument");
+    Spec s = spec;
+    s.conv = 'x';
+    s.flags |= F_ALT;
+    emit_int(out, reinterpret_cast<uintptr_t>(arg), s);
+  } else if constexpr (c == 'f' || c == 'F') {
+    static_assert(std::is_arithmetic_v<T>, "%f requires a numeric argument");
+    static_assert(spec.prec <= 9, "%f precision may be at most 9");
+    if constexpr (std::is_floating_point_v<T>)
+      emit_float(out, arg, spec);
+    else
+      emit_float(out, static_cast<float>(arg), spec);
+  } else {
+    static_assert(c == 'd', "unsupported conversion specifier");
+  }
+}
+
+/// Emits the format from Pos onward: a literal run up to the next
+/// specification, then that specification, then the rest.
+template <typename Fmt, size_t Pos, typename... Args>
+inline void run(Output &out, const Args &...args);
+
+template <typename Fmt, size_t Pos, typename T, typename... Rest>
+inline void run_arg(Output &out, const T &arg, const Rest &...rest) {
+  convert<Fmt, Pos>(out, arg);
+  run<Fmt, parse_spec(Fmt::str(), Pos).end>(out, rest...);
+}
+
+template <typename Fmt, size_t Pos, typename... Args>
+inline void run(Output &out, const Args &...args) {
+  constexpr const char *s = Fmt::str();
+  constexpr size_t lit_end = find_spec(s, Pos);
+  if constexpr (lit_end != Pos)
+    out.write(s + Pos, lit_end - Pos);
+
+  if constexpr (!s[lit_end]) {
+    static_assert(sizeof...(Args) == 0, "too many arguments for format");
+  } else {
+    constexpr Spec spec = parse_spec(s, lit_end);
+    if constexpr (spec.conv == '%') {
+      out.put('%');
+      run<Fmt, spec.end>(out, args...);
+    } else {
+      static_assert(sizeof...(Args) != 0, "too few arguments for format");
+      if constexpr (sizeof...(Args) != 0)
+        run_arg<Fmt, lit_end>(out, args...);
+    }
+  }
+}
+
+#if __cplusplus >= 202002L
+template <size_t N> struct FixedString {
+  char data[N];
+  consteval FixedString(const char (&s)[N]) {
+    for (size_t i = 0; i < N; ++i)
+      data[i] = s[i];
+  }
+};
+
+template <FixedString S> struct Literal {
+  static constexpr const char *str() { return S.data; }
+};
+#endif
+
+} // namespace __impl
+
+/// Formats args according to Fmt into an Output.
+template <typename Fmt, typename... Args>
+inline size_t format(Output &out, Fmt, const Args &...args) {
+  __impl::run<Fmt, 0>(out, args...);
+  return out.count();
+}
+
+/// Formats to a stdio stream. Returns the number of characters written.
+template <typename Fmt, typename... Args>
+inline int fprint(FILE *stream, Fmt fmt, const Args &...args) {
+  Output out(stream);
+  return format(out, fmt, args...);
+}
+
+/// Formats to stdout. Returns the number of characters written.
+template <typename Fmt, typename... Args>
+inline int print(Fmt fmt, const Args &...args) {
+  return fprint(stdout, fmt, args...);
+}
+
+/// Formats to a buffer of size n, always null-terminating if n is nonzero.
+/// Returns the number of characters that would have been written had n been
+/// large enough, as with snprintf.
+template <typename Fmt, typename... Args>
+inline int snprint(char *s, size_t n, Fmt fmt, const Args &...args) {
+  Output out(s, n);
+  format(out, fmt, args...);
+  out.finish();
+  return out.count();
+}
+
+#if __cplusplus >= 202002L
+template <__impl::FixedString S, typename... Args>
+inline int fprint(FILE *stream, const Args &...args) {
+  return fprint(stream, __impl::Literal<S>{}, args...);
+}
+
+template <__impl::FixedString S, typename... Args>
+inline int print(const Args &...args) {
+  return print(__impl::Literal<S>{}, args...);
+}
+
+template <__impl::FixedString S, typename... Args>
+inline int snprint(char *s, size_t n, const Args &...args) {
+  return snprint(s, n, __impl::Literal<S>{}, args...);
+}
+#endif
+
+} // namespace cprintf
+
+/// Wraps a string literal as a compile-time format for the cprintf functions.
+#define CPRINTF_FORMAT(s)                                                      \
+  ([] {                                                                        \
+    struct __cprintf_format {                                                  \
+      static constexpr const char *str() { return s; }                         \
+    };                                                                         \
+    return __cprintf_format{};                                                 \
+  }())
+
+#endif // not _COMPILED_PRINTF_H
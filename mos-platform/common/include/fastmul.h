@@ -0,0 +1,35 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _FASTMUL_H_
+#define _FASTMUL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Table-driven multiplication; link with -lfastmul.
+//
+// The fastmul library multiplies by the quarter-square identity
+//   a * b = floor((a + b)^2 / 4) - floor((a - b)^2 / 4),
+// looking squares up in 1 KiB of page-aligned tables. Linking it also
+// replaces the compiler's __mulqi3, __mulhi3, __mulsi3, and __muldi3 libcalls,
+// so ordinary `*` expressions get faster as well, at the cost of the tables.
+
+// Full-width products of 8-bit operands.
+uint16_t fastmul_u8x8(uint8_t a, uint8_t b);
+int16_t fastmul_s8x8(int8_t a, int8_t b);
+
+// Full-width products of 16-bit operands.
+uint32_t fastmul_u16x16(uint16_t a, uint16_t b);
+int32_t fastmul_s16x16(int16_t a, int16_t b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // not _FASTMUL_H_
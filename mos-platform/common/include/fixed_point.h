@@ -17,6 +17,102 @@
 #define __fp_consteval constexpr
 #endif
 
+namespace fixedpoint {
+namespace __impl {
+
+// 8x8->16 multiply. With a byte-sized multiplier, the runtime's shift-and-add
+// loop runs at most eight rounds.
+[[clang::always_inline]] constexpr uint16_t mul8x8(uint8_t a, uint8_t b) {
+  return (uint16_t)((uint16_t)a * b);
+}
+
+// Unsigned 16x16->32 multiply from four byte products.
+[[clang::always_inline]] constexpr uint32_t mul16x16(uint16_t a, uint16_t b) {
+#if defined(__MEGA65__)
+  // The math unit backs the runtime's __mulsi3, which beats any assembly of
+  // partial products.
+  return (uint32_t)a * b;
+#elif defined(__LYNX__)
+  // The runtime's __mulsi3 hands a 16x16 product straight to Suzy.
+  return (uint32_t)a * b;
+#else
+  uint8_t al = (uint8_t)a, ah = (uint8_t)(a >> 8);
+  uint8_t bl = (uint8_t)b, bh = (uint8_t)(b >> 8);
+  uint16_t ll = mul8x8(al, bl);
+  uint16_t t = (uint16_t)((ll >> 8) + mul8x8(ah, bl));
+  uint16_t u = (uint16_t)((uint8_t)t + mul8x8(al, bh));
+  uint16_t hi = (uint16_t)(mul8x8(ah, bh) + (t >> 8) + (u >> 8));
+  return (uint32_t)hi << 16 | (uint16_t)(u << 8 | (uint8_t)ll);
+#endif
+}
+
+// High half of the unsigned 16x16 product; the unused low bytes fold away.
+[[clang::always_inline]] constexpr uint16_t mul_hi16(uint16_t a, uint16_t b) {
+  return (uint16_t)(mul16x16(a, b) >> 16);
+}
+
+// A negative two's complement operand is its unsigned reading minus 2^16, so
+// the signed product subtracts the other operand from the high half.
+template <bool Signed>
+[[clang::always_inline]] constexpr uint32_t mul16(uint16_t a, uint16_t b) {
+  uint32_t p = mul16x16(a, b);
+  if constexpr (Signed) {
+    if ((int16_t)a < 0)
+      p -= (uint32_t)b << 16;
+    if ((int16_t)b < 0)
+      p -= (uint32_t)a << 16;
+  }
+  return p;
+}
+
+// Bits 8 through 23 of a 16x16 product, for 8.8. Only the low byte of the
+// high-by-high product survives, so it's an 8-bit multiply.
+template <bool Signed>
+[[clang::always_inline]] constexpr uint16_t mul_8_8(uint16_t a, uint16_t b) {
+#ifdef __MEGA65__
+  return (uint16_t)(mul16<Signed>(a, b) >> 8);
+#else
+  uint8_t al = (uint8_t)a, ah = (uint8_t)(a >> 8);
+  uint8_t bl = (uint8_t)b, bh = (uint8_t)(b >> 8);
+  uint16_t t = (uint16_t)((mul8x8(al, bl) >> 8) + mul8x8(ah, bl));
+  uint16_t u = (uint16_t)((uint8_t)t + mul8x8(al, bh));
+  uint8_t top = (uint8_t)((uint8_t)(ah * bh) + (t >> 8) + (u >> 8));
+  if constexpr (Signed) {
+    if ((int8_t)ah < 0)
+      top -= bl;
+    if ((int8_t)bh < 0)
+      top -= al;
+  }
+  return (uint16_t)(top << 8 | (uint8_t)u);
+#endif
+}
+
+// Bits 16 through 47 of a 32x32 product, for 16.16. Only the low half of the
+// high-by-high product survives, and only the high half of the low-by-low.
+template <bool Signed>
+[[clang::always_inline]] constexpr uint32_t mul_16_16(uint32_t a, uint32_t b) {
+  uint16_t al = (uint16_t)a, ah = (uint16_t)(a >> 16);
+  uint16_t bl = (uint16_t)b, bh = (uint16_t)(b >> 16);
+#ifdef __MEGA65__
+  // The runtime's __muldi3 forms a product of widened 32-bit operands with a
+  // single pass through the math unit.
+  uint32_t r = (uint32_t)((uint64_t)a * b >> 16);
+#else
+  uint32_t r = (uint32_t)(uint16_t)((uint32_t)ah * bh) << 16;
+  r += mul16x16(ah, bl) + mul16x16(al, bh) + mul_hi16(al, bl);
+#endif
+  if constexpr (Signed) {
+    if ((int16_t)ah < 0)
+      r -= (uint32_t)bl << 16;
+    if ((int16_t)bh < 0)
+      r -= (uint32_t)al << 16;
+  }
+  return r;
+}
+
+} // namespace __impl
+} // namespace fixedpoint
+
 /// Numeric Wrapper for Fixed Point math
 ///
 /// Without dedicated floating point hardware, fixed point math is a good choice
@@ -226,7 +322,13 @@ public:
   }
 
   [[clang::always_inline]] constexpr FixedPoint &operator/=(FixedPoint o) {
-    val /= o.get();
+    // Fixed point division is (n << FracSize) / m, done in the narrowest
+    // standard type that holds the shifted dividend.
+    using Wide = std::conditional_t<
+        storage_size + FracSize <= 32,
+        std::conditional_t<Signed, int32_t, uint32_t>,
+        std::conditional_t<Signed, int64_t, uint64_t>>;
+    val = (StorageType)(((Wide)val << FracSize) / (Wide)o.val);
     return *this;
   }
   [[clang::always_inline]] constexpr FixedPoint operator/(FixedPoint o) const {
@@ -236,12 +338,27 @@ public:
   }
 
   [[clang::always_inline]] constexpr FixedPoint &operator*=(FixedPoint o) {
-    // Fixed point mult is (n * m / FracSize)
-    // Expand the immediate value before multiplying
-    FixedPoint<IntSize * 2, FracSize, Signed> temp{*this};
-    FixedPoint<IntSize * 2, FracSize, Signed> other{o};
-    // Truncate the final result to fit inside our value
-    val = (temp.get() * other.get()) >> FracSize;
+    using namespace fixedpoint::__impl;
+    // Fixed point mult is (n * m / FracSize). The common formats build the
+    // product from byte or word partial products, computing only the parts
+    // that survive the shift, instead of a full double-width multiply.
+    if constexpr (storage_size == 16 && FracSize == 8) {
+      val = (StorageType)mul_8_8<Signed>((uint16_t)val, (uint16_t)o.val);
+    } else if constexpr (storage_size == 16) {
+      uint32_t p = mul16<Signed>((uint16_t)val, (uint16_t)o.val);
+      if constexpr (Signed)
+        val = (StorageType)((int32_t)p >> FracSize);
+      else
+        val = (StorageType)(p >> FracSize);
+    } else if constexpr (storage_size == 32 && FracSize == 16) {
+      val = (StorageType)mul_16_16<Signed>((uint32_t)val, (uint32_t)o.val);
+    } else {
+      // Expand the immediate value before multiplying
+      FixedPoint<IntSize * 2, FracSize, Signed> temp{*this};
+      FixedPoint<IntSize * 2, FracSize, Signed> other{o};
+      // Truncate the final result to fit inside our value
+      val = (temp.get() * other.get()) >> FracSize;
+    }
     return *this;
   }
   [[clang::always_inline]] constexpr FixedPoint operator*(FixedPoint o) const {
@@ -462,6 +579,7 @@ public:
 namespace fixedpoint_literals {
 
 using fs8_8 = FixedPoint<8, 8, true>;
+using fs4_12 = FixedPoint<4, 12, true>;
 using fs12_4 = FixedPoint<12, 4, true>;
 using fs16_8 = FixedPoint<16, 8, true>;
 using fs8_16 = FixedPoint<8, 16, true>;
@@ -470,6 +588,7 @@ using fs16_16 = FixedPoint<16, 16, true>;
 using fs24_8 = FixedPoint<24, 8, true>;
 
 using fu8_8 = FixedPoint<8, 8, false>;
+using fu4_12 = FixedPoint<4, 12, false>;
 using fu12_4 = FixedPoint<12, 4, false>;
 using fu16_8 = FixedPoint<16, 8, false>;
 using fu8_16 = FixedPoint<8, 16, false>;
@@ -478,6 +597,7 @@ using fu16_16 = FixedPoint<16, 16, false>;
 using fu24_8 = FixedPoint<24, 8, false>;
 
 using f8_8 = fs8_8;
+using f4_12 = fs4_12;
 using f12_4 = fs12_4;
 using f16_8 = fs16_8;
 using f8_16 = fs8_16;
@@ -489,6 +609,10 @@ using f24_8 = fs24_8;
 operator""_s8_8(long double fixed) {
   return FixedPoint<8, 8, true>{fixed};
 }
+[[clang::always_inline]] __fp_consteval fs4_12
+operator""_s4_12(long double fixed) {
+  return FixedPoint<4, 12, true>{fixed};
+}
 [[clang::always_inline]] __fp_consteval fs12_4
 operator""_s12_4(long double fixed) {
   return FixedPoint<12, 4, true>{fixed};
@@ -518,6 +642,10 @@ operator""_s24_8(long double fixed) {
 operator""_u8_8(long double fixed) {
   return FixedPoint<8, 8, false>{fixed};
 }
+[[clang::always_inline]] __fp_consteval fu4_12
+operator""_u4_12(long double fixed) {
+  return FixedPoint<4, 12, false>{fixed};
+}
 [[clang::always_inline]] __fp_consteval fu12_4
 operator""_u12_4(long double fixed) {
   return FixedPoint<12, 4, false>{fixed};
@@ -547,6 +675,10 @@ operator""_u24_8(long double fixed) {
 operator""_8_8(long double fixed) {
   return FixedPoint<8, 8, true>{fixed};
 }
+[[clang::always_inline]] __fp_consteval fs4_12
+operator""_4_12(long double fixed) {
+  return FixedPoint<4, 12, true>{fixed};
+}
 [[clang::always_inline]] __fp_consteval fs12_4
 operator""_12_4(long double fixed) {
   return FixedPoint<12, 4, true>{fixed};
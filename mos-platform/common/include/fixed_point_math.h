@@ -0,0 +1,303 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _FIXED_POINT_MATH_H
+#define _FIXED_POINT_MATH_H
+
+#include <fixed_point.h>
+#include <fixmath.h>
+
+/// Math functions for FixedPoint values.
+///
+/// Angles are 8-bit binary angles: 256 units make a full turn, so ordinary
+/// wrapping uint8_t arithmetic is arithmetic modulo 2*pi, and an angle indexes
+/// a quarter-wave table directly. sin, cos and atan2 read the tables behind
+/// the radian functions in <fixmath.h>, and reciprocal generates its table at
+/// compile time. Every routine works on the raw integer representation, so no
+/// call round trips through soft float.
+///
+/// The functions accept any format with 16 or 32 bits of storage, such as the
+/// common 8.8, 4.12 and 16.16. The 16-bit formats do all their work in 16- and
+/// 32-bit integers; 16.16 adds a second refinement step where it needs the
+/// precision.
+///
+/// Usage example:
+///
+///   using namespace fixedpoint_literals;
+///   uint8_t heading = fixedpoint::atan2(dy, dx);
+///   f8_8 vx = fixedpoint::cos<f8_8>(heading) * speed;
+///   f8_8 vy = fixedpoint::sin<f8_8>(heading) * speed;
+namespace fixedpoint {
+
+namespace __impl {
+
+template <typename F> struct Format;
+template <intmax_t IntSize, intmax_t FracSize, bool Signed>
+struct Format<FixedPoint<IntSize, FracSize, Signed>> {
+  static constexpr intmax_t int_bits = IntSize;
+  static constexpr intmax_t frac_bits = FracSize;
+  static constexpr intmax_t bits = IntSize + FracSize;
+  static constexpr bool is_signed = Signed;
+  static_assert(bits == 16 || bits == 32,
+                "fixed point math requires 16 or 32 bits of storage");
+  static_assert(FracSize <= 24, "too many fractional bits");
+
+  using Unsigned = std::conditional_t<bits == 16, uint16_t, uint32_t>;
+  using Raw = std::conditional_t<
+      Signed, std::conditional_t<bits == 16, int16_t, int32_t>, Unsigned>;
+  // Largest raw value.
+  static constexpr uint32_t max = (Unsigned)~(Unsigned)0 >> Signed;
+};
+
+template <typename F> constexpr auto raw(F x) {
+  return (typename Format<F>::Raw)x.get();
+}
+
+template <typename F> constexpr F from_raw(typename Format<F>::Raw v) {
+  F r{0};
+  r.set(v);
+  return r;
+}
+
+template <typename F> constexpr auto magnitude(F x) {
+  using U = typename Format<F>::Unsigned;
+  auto v = raw(x);
+  if constexpr (Format<F>::is_signed)
+    return v < 0 ? (U)-(U)v : (U)v;
+  else
+    return (U)v;
+}
+
+// Saturating conversion of a magnitude to F, applying the sign.
+template <typename F> constexpr F saturate(uint32_t mag, bool negative) {
+  using Raw = typename Format<F>::Raw;
+  if (mag > Format<F>::max)
+    mag = Format<F>::max;
+  Raw r = (Raw)mag;
+  if constexpr (Format<F>::is_signed)
+    if (negative)
+      r = (Raw)-r;
+  return from_raw<F>(r);
+}
+
+// Compile-time table storage; the contents are generated by constexpr code.
+template <typename T, size_t N> struct Table {
+  T v[N];
+  constexpr T operator[](size_t i) const { return v[i]; }
+};
+
+// 1/c in 1.15 for c = 1/2 + (i + 1/2)/128, i in [0, 64): the midpoints of the
+// intervals selected by the six bits after a normalized leading one.
+constexpr Table<uint16_t, 64> make_recip_table() {
+  Table<uint16_t, 64> t{};
+  for (int i = 0; i < 64; ++i)
+    t.v[i] = (uint16_t)(32768 / (0.5 + (i + 0.5) / 128) + 0.5);
+  return t;
+}
+inline constexpr auto recip_table = make_recip_table();
+
+// Rounded digit-by-digit square root of x * 4^extra_pairs.
+template <typename X> constexpr uint32_t sqrt_bits(X x, uint8_t extra_pairs) {
+  uint32_t root = 0, rem = 0;
+  for (uint8_t i = sizeof(X) * 4 + extra_pairs; i; --i) {
+    rem = rem << 2 | (uint8_t)(x >> (sizeof(X) * 8 - 2));
+    x = (X)(x << 2);
+    uint32_t trial = root << 2 | 1;
+    root <<= 1;
+    if (rem >= trial) {
+      rem -= trial;
+      root |= 1;
+    }
+  }
+  // (root + 1/2)^2 = root^2 + root + 1/4.
+  if (rem > root)
+    ++root;
+  return root;
+}
+
+// 1/m in 2.30 for m in [1/2, 1), given in 0.32. One Newton step from the table
+// gives about 14 bits; the second, done only when asked for, gives about 26.
+template <bool Precise> constexpr uint32_t recip_normalized(uint32_t m) {
+  uint16_t y0 = recip_table[(uint8_t)(m >> 25) & 63];
+  uint16_t mh = (uint16_t)(m >> 16);
+
+  // y1 = y0 + y0 * (1 - m*y0), with the error term in 1.31.
+  int32_t e = (int32_t)(0x80000000 - (uint32_t)mh * y0);
+  uint32_t y = ((uint32_t)y0 << 15) + (uint32_t)((int32_t)y0 * (e >> 10) >> 6);
+  if constexpr (!Precise)
+    return y;
+
+  uint16_t ml = (uint16_t)m;
+  uint16_t yh = (uint16_t)(y >> 16);
+  uint16_t yl = (uint16_t)y;
+  // m*y in 1.31, dropping the negligible low-by-low partial product.
+  uint32_t p = ((uint32_t)mh * yh << 1) + ((uint32_t)mh * yl >> 15) +
+               ((uint32_t)ml * yh >> 15);
+  e = (int32_t)(0x80000000 - p);
+  return y + (uint32_t)((int32_t)yh * (e >> 4) >> 11);
+}
+
+} // namespace __impl
+
+/// Sine of a binary angle (256 units per turn), precise to 16 fractional
+/// bits.
+template <typename F> [[clang::always_inline]] F sin(uint8_t angle) {
+  using Fmt = __impl::Format<F>;
+  static_assert(Fmt::is_signed && Fmt::int_bits >= 2,
+                "sin requires a signed format that can hold 1.0");
+  constexpr intmax_t frac = Fmt::frac_bits;
+  uint8_t i = angle & 63;
+  // Every other entry of the table falls on a binary angle.
+  uint8_t idx = (uint8_t)(((angle & 64) ? 64 - i : i) * 2);
+  uint32_t s = __fix_sin_table[idx];
+  uint32_t v;
+  if (idx == 128)
+    v = (uint32_t)1 << frac; // The table saturates 1.0 to 0xffff.
+  else if constexpr (frac < 16)
+    v = (s + ((uint32_t)1 << (15 - frac))) >> (16 - frac);
+  else
+    v = s << (frac - 16);
+  auto r = (typename Fmt::Raw)v;
+  return __impl::from_raw<F>((angle & 128) ? (typename Fmt::Raw)-r : r);
+}
+
+/// Cosine of a binary angle (256 units per turn), precise to 16 fractional
+/// bits.
+template <typename F> [[clang::always_inline]] F cos(uint8_t angle) {
+  return sin<F>((uint8_t)(angle + 64));
+}
+
+/// The binary angle (256 units per turn) of the vector (x, y), accurate to
+/// about one unit. atan2(0, 0) is zero.
+template <typename F> uint8_t atan2(F y, F x) {
+  using Fmt = __impl::Format<F>;
+  auto ax = __impl::magnitude(x);
+  auto ay = __impl::magnitude(y);
+  bool swap = ay > ax;
+  auto lo = swap ? ax : ay;
+  auto hi = swap ? ay : ax;
+
+  uint8_t a = 0;
+  if (hi) {
+    // Keep lo << 7 in range; the index only needs about six bits.
+    while (hi >> (Fmt::bits - 8)) {
+      hi >>= 1;
+      lo >>= 1;
+    }
+    auto t = (decltype(lo))(lo << 7) / hi;
+    // Radians in 0.16 to binary angles: 2^8 * 128/pi is about 10430.
+    uint16_t rad = __fix_atan_table[(uint8_t)((t + 1) >> 1)];
+    a = (uint8_t)(((uint32_t)rad * 10430 + ((uint32_t)1 << 23)) >> 24);
+  }
+
+  if (swap)
+    a = 64 - a;
+  if (__impl::raw(x) < 0)
+    a = 128 - a;
+  if (__impl::raw(y) < 0)
+    a = (uint8_t)-a;
+  return a;
+}
+
+/// Square root, rounded to nearest. Negative arguments give zero.
+template <typename F> constexpr F sqrt(F x) {
+  using Fmt = __impl::Format<F>;
+  using U = typename Fmt::Unsigned;
+  if (__impl::raw(x) <= 0)
+    return F{0};
+  U v = (U)__impl::raw(x);
+  // Square root of v * 2^frac_bits.
+  uint32_t root;
+  if constexpr (Fmt::frac_bits % 2 == 0)
+    root = __impl::sqrt_bits<U>(v, Fmt::frac_bits / 2);
+  else if constexpr (Fmt::bits == 16)
+    root = __impl::sqrt_bits<uint32_t>((uint32_t)v << 1, Fmt::frac_bits / 2);
+  else
+    root = __impl::sqrt_bits<uint64_t>((uint64_t)v << 1, Fmt::frac_bits / 2);
+  return __impl::from_raw<F>((typename Fmt::Raw)root);
+}
+
+/// Reciprocal, 1/x, by a table lookup and Newton refinement. 16-bit formats
+/// are corrected to the nearest representable value; 16.16 and other 32-bit
+/// formats are accurate to about 2^-25 relative. Results that don't fit, as
+/// well as 1/0, saturate.
+template <typename F> constexpr F reciprocal(F x) {
+  using Fmt = __impl::Format<F>;
+  constexpr intmax_t frac = Fmt::frac_bits;
+  bool negative = __impl::raw(x) < 0;
+  uint32_t v = __impl::magnitude(x);
+  if (!v)
+    return __impl::saturate<F>(UINT32_MAX, false);
+
+  // Normalize v into m in [1/2, 1).
+  uint8_t s = 0;
+  uint32_t m = v;
+  while (!(m & 0x80000000)) {
+    m <<= 1;
+    ++s;
+  }
+  uint32_t y = __impl::recip_normalized<(Fmt::bits > 16)>(m);
+
+  // 1/x = 2^(2*frac + s - 32) / m, and y is 1/m in 2.30.
+  int8_t shift = (int8_t)(62 - 2 * frac - s);
+  if (shift >= 32)
+    return F{0};
+  uint32_t r;
+  if (shift > 0)
+    r = (y + ((uint32_t)1 << (shift - 1))) >> shift;
+  else if (!shift)
+    r = y;
+  else if (shift == -1 && !(y & 0x80000000))
+    r = y << 1;
+  else
+    return __impl::saturate<F>(UINT32_MAX, negative);
+
+  if constexpr (Fmt::bits == 16) {
+    if (r > Fmt::max + 1)
+      return __impl::saturate<F>(r, negative);
+    // Fix up the last bit by checking the remainder of 2^(2*frac) / v.
+    using Wide = std::conditional_t<(2 * frac < 31), int32_t, int64_t>;
+    constexpr Wide one = (Wide)1 << (2 * frac);
+    Wide rem = one - (Wide)r * v;
+    while (rem < 0) {
+      --r;
+      rem += v;
+    }
+    while (rem >= (Wide)v) {
+      ++r;
+      rem -= v;
+    }
+    if (2 * rem >= (Wide)v)
+      ++r;
+  }
+  return __impl::saturate<F>(r, negative);
+}
+
+/// Linear interpolation: a at t = 0, b at t = 1.
+template <typename F>
+[[clang::always_inline]] constexpr F lerp(F a, F b, F t) {
+  return a + (b - a) * t;
+}
+
+/// Linear interpolation with an 8-bit fraction t in 1/256ths: a at t = 0,
+/// nearly b at t = 255. This costs one 8x8 multiply per byte of storage.
+template <typename F> constexpr F lerp8(F a, F b, uint8_t t) {
+  using Fmt = __impl::Format<F>;
+  using U = typename Fmt::Unsigned;
+  auto ra = __impl::raw(a), rb = __impl::raw(b);
+  // (b - a) * t >> 8 in the storage width: the wrapped difference times t,
+  // byte by byte, less t << (bits - 8) to undo the wrap of a negative one.
+  U d = (U)(rb - ra);
+  U step = (U)(__impl::mul8x8((uint8_t)d, t) >> 8);
+  for (uint8_t i = 1; i < sizeof(U); ++i)
+    step += (U)((U)__impl::mul8x8((uint8_t)(d >> 8 * i), t) << 8 * (i - 1));
+  if (rb < ra)
+    step -= (U)((U)t << (Fmt::bits - 8));
+  return __impl::from_raw<F>((typename Fmt::Raw)(ra + step));
+}
+
+} // namespace fixedpoint
+
+#endif // _FIXED_POINT_MATH_H
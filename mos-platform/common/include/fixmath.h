@@ -0,0 +1,78 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _FIXMATH_H_
+#define _FIXMATH_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-point counterparts of the <math.h> subset.
+//
+// fix8_t holds a signed 8.8 value and fix16_t a signed 16.16 value. These
+// routines use only integer arithmetic and small tables, so they never pull in
+// the soft-float runtime. Angles are in radians. Results that don't fit
+// saturate to the most positive or negative value of the type.
+//
+// <fixed_point_math.h> offers binary-angle versions of sin, cos and atan2 for
+// FixedPoint values. They read the same tables, declared below.
+
+typedef int16_t fix8_t;
+typedef int32_t fix16_t;
+
+#define FIX8_ONE ((fix8_t)0x100)
+#define FIX16_ONE ((fix16_t)0x10000)
+#define FIX8_MAX ((fix8_t)INT16_MAX)
+#define FIX8_MIN ((fix8_t)INT16_MIN)
+#define FIX16_MAX ((fix16_t)INT32_MAX)
+#define FIX16_MIN ((fix16_t)INT32_MIN)
+
+static inline fix8_t fix8_abs(fix8_t x) {
+  return x >= 0 ? x : x == FIX8_MIN ? FIX8_MAX : (fix8_t)-x;
+}
+static inline fix16_t fix16_abs(fix16_t x) {
+  return x >= 0 ? x : x == FIX16_MIN ? FIX16_MAX : -x;
+}
+
+static inline fix8_t fix8_floor(fix8_t x) { return (fix8_t)(x & ~0xff); }
+static inline fix16_t fix16_floor(fix16_t x) { return x & ~(fix16_t)0xffff; }
+
+// Rounds halfway cases away from zero, like roundf.
+fix8_t fix8_round(fix8_t x);
+fix16_t fix16_round(fix16_t x);
+
+// Returns zero for negative arguments.
+fix8_t fix8_sqrt(fix8_t x);
+fix16_t fix16_sqrt(fix16_t x);
+
+// sin(i * pi/256) in 0.16 for i in [0, 128]; 1.0 saturates to 0xffff.
+extern const uint16_t __fix_sin_table[129];
+// atan(i/64) in 0.16 radians for i in [0, 64].
+extern const uint16_t __fix_atan_table[65];
+
+fix8_t fix8_sin(fix8_t x);
+fix8_t fix8_cos(fix8_t x);
+fix16_t fix16_sin(fix16_t x);
+fix16_t fix16_cos(fix16_t x);
+
+// atan2(0, 0) is zero.
+fix8_t fix8_atan2(fix8_t y, fix8_t x);
+fix16_t fix16_atan2(fix16_t y, fix16_t x);
+
+fix8_t fix8_exp(fix8_t x);
+fix16_t fix16_exp(fix16_t x);
+
+// Returns the most negative value for arguments <= 0.
+fix8_t fix8_log(fix8_t x);
+fix16_t fix16_log(fix16_t x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // not _FIXMATH_H_
@@ -16,14 +16,31 @@ extern "C" {
 #define FP_NAN 4
 
 #define INFINITY (1.0f / 0.0f)
+#define NAN __builtin_nanf("")
 
 #define isnan(arg) __builtin_isnan(arg)
+#define isinf(arg) __builtin_isinf(arg)
 
 double fmin(double x, double y);
 double fmax(double x, double y);
 float fminf(float x, float y);
 float fmaxf(float x, float y);
 
+float fabsf(float x);
+float floorf(float x);
+float roundf(float x);
+float sqrtf(float x);
+
+// The transcendental functions reduce onto small tables and finish with a
+// short polynomial; results are within a few ULPs. Near their zeros, sinf and
+// cosf are accurate to a few ULPs of 1 instead, and they lose accuracy for
+// |x| beyond about 2^16, since the argument reduction uses a two-part pi.
+float sinf(float x);
+float cosf(float x);
+float atan2f(float y, float x);
+float expf(float x);
+float logf(float x);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,39 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _RADIX_SORT_H_
+#define _RADIX_SORT_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Counting sorts for up to 255 objects keyed by one or two bytes.
+//
+// Rather than moving records, these fill perm with the indices of the keys in
+// ascending key order, so that keys[perm[0]] <= keys[perm[1]] <= ... . Each
+// array can then be visited through perm; for descending order, walk perm
+// backwards. The sorts are stable and take O(n) time, plus two passes over a
+// 256-byte histogram per key byte.
+//
+// The histogram is static, so these must not be called from an interrupt
+// handler while another call may be in progress.
+
+// Sort by one-byte keys.
+void radix_sort_u8(const uint8_t *keys, uint8_t n, uint8_t *perm);
+
+// Sort by two-byte keys, given as separate arrays of low and high bytes (the
+// layout soa::Array uses for 16-bit elements). tmp must have room for n
+// indices.
+void radix_sort_u16(const uint8_t *keys_lo, const uint8_t *keys_hi, uint8_t n,
+                    uint8_t *perm, uint8_t *tmp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // not _RADIX_SORT_H_
@@ -0,0 +1,686 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#ifndef _STATIC_CONTAINERS_H
+#define _STATIC_CONTAINERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <soa.h>
+#include <type_traits>
+
+/// Fixed-capacity containers that never allocate.
+///
+/// Each container holds its elements inline, so its size is known at compile
+/// time and a static instance lives entirely in BSS or data. Whenever the
+/// capacity N is at most 256, indices and sizes are 8 bits wide (a size of
+/// exactly 256 needs 16), so that element accesses can use the X and Y index
+/// registers directly. Operations that could overflow the capacity report
+/// failure through their return value instead of allocating.
+///
+/// Elements are never destroyed, only overwritten, so element types must be
+/// trivially destructible. The containers that take an `SoA` parameter can
+/// keep their elements in a soa::Array instead of a C array; this requires the
+/// same "plain old data" element types as soa::Array, and N of at most 255.
+/// Element access then yields soa::Ptr proxies instead of references. As with
+/// soa::Array, the benefit only materializes for containers at a fixed
+/// address, e.g. globals or statics.
+namespace static_containers {
+
+namespace __impl {
+
+/// Type of an index into N elements.
+template <size_t N>
+using index_t = std::conditional_t<(N <= 256), uint8_t, uint16_t>;
+
+/// Type of an element count from 0 to N.
+template <size_t N>
+using count_t = std::conditional_t<(N <= 255), uint8_t, uint16_t>;
+
+template <typename T, size_t N, bool SoA> class Storage {
+  static_assert(std::is_trivially_destructible_v<T>,
+                "elements must be trivially destructible");
+
+  T Elems[N] = {};
+
+public:
+  using reference = T &;
+  using const_reference = const T &;
+
+  [[clang::always_inline]] constexpr T &operator[](index_t<N> Idx) {
+    return Elems[Idx];
+  }
+  [[clang::always_inline]] constexpr const T &
+  operator[](index_t<N> Idx) const {
+    return Elems[Idx];
+  }
+  [[clang::always_inline]] constexpr T *data() { return Elems; }
+  [[clang::always_inline]] constexpr const T *data() const { return Elems; }
+};
+
+template <typename T, size_t N> class Storage<T, N, true> {
+  static_assert(N <= 255, "SoA storage holds at most 255 elements");
+
+  soa::Array<T, N> Elems;
+
+public:
+  using reference = soa::Ptr<T>;
+  using const_reference = soa::Ptr<const T>;
+
+  [[clang::always_inline]] constexpr reference operator[](uint8_t Idx) {
+    return Elems[Idx];
+  }
+  [[clang::always_inline]] constexpr const_reference
+  operator[](uint8_t Idx) const {
+    return Elems[Idx];
+  }
+};
+
+/// Iterator over a container by logical index, for storage without pointers
+/// to elements.
+template <typename C, typename Ref> class IndexIterator {
+  C *Container;
+  typename C::size_type Idx;
+
+public:
+  [[clang::always_inline]] constexpr IndexIterator(
+      C *Container, typename C::size_type Idx)
+      : Container(Container), Idx(Idx) {}
+
+  [[clang::always_inline]] constexpr Ref operator*() const {
+    return (*Container)[Idx];
+  }
+  [[clang::always_inline]] constexpr IndexIterator &operator++() {
+    ++Idx;
+    return *this;
+  }
+  constexpr bool operator==(const IndexIterator &Other) const {
+    return Idx == Other.Idx;
+  }
+  constexpr bool operator!=(const IndexIterator &Other) const {
+    return Idx != Other.Idx;
+  }
+};
+
+inline constexpr uint8_t BitMasks[8] = {0x01, 0x02, 0x04, 0x08,
+                                        0x10, 0x20, 0x40, 0x80};
+
+} // namespace __impl
+
+/// A vector with storage for N elements.
+template <typename T, size_t N, bool SoA = false> class static_vector {
+  using Store = __impl::Storage<T, N, SoA>;
+
+public:
+  using value_type = T;
+  using size_type = __impl::count_t<N>;
+  using index_type = __impl::index_t<N>;
+  using reference = typename Store::reference;
+  using const_reference = typename Store::const_reference;
+  using iterator =
+      std::conditional_t<SoA, __impl::IndexIterator<static_vector, reference>,
+                         T *>;
+  using const_iterator = std::conditional_t<
+      SoA, __impl::IndexIterator<const static_vector, const_reference>,
+      const T *>;
+
+  constexpr static_vector() = default;
+
+  static constexpr size_type capacity() { return N; }
+  constexpr size_type size() const { return Size; }
+  [[nodiscard]] constexpr bool empty() const { return !Size; }
+  constexpr bool full() const { return Size == N; }
+
+  constexpr reference operator[](index_type Idx) { return Elems[Idx]; }
+  constexpr const_reference operator[](index_type Idx) const {
+    return Elems[Idx];
+  }
+  constexpr reference front() { return Elems[0]; }
+  constexpr const_reference front() const { return Elems[0]; }
+  constexpr reference back() { return Elems[Size - 1]; }
+  constexpr const_reference back() const { return Elems[Size - 1]; }
+
+  constexpr iterator begin() {
+    if constexpr (SoA)
+      return {this, 0};
+    else
+      return Elems.data();
+  }
+  constexpr iterator end() {
+    if constexpr (SoA)
+      return {this, Size};
+    else
+      return Elems.data() + Size;
+  }
+  constexpr const_iterator begin() const {
+    if constexpr (SoA)
+      return {this, 0};
+    else
+      return Elems.data();
+  }
+  constexpr const_iterator end() const {
+    if constexpr (SoA)
+      return {this, Size};
+    else
+      return Elems.data() + Size;
+  }
+
+  constexpr void clear() { Size = 0; }
+
+  /// Append an element; returns false if the vector is full.
+  constexpr bool push_back(const T &Value) {
+    if (full())
+      return false;
+    Elems[Size++] = Value;
+    return true;
+  }
+
+  constexpr void pop_back() { --Size; }
+
+  /// Insert an element before Idx; returns false if the vector is full.
+  constexpr bool insert(index_type Idx, const T &Value) {
+    if (full())
+      return false;
+    for (size_type I = Size; I != Idx; --I)
+      Elems[I] = static_cast<T>(Elems[I - 1]);
+    Elems[Idx] = Value;
+    ++Size;
+    return true;
+  }
+
+  /// Remove the element at Idx, keeping the order of the rest.
+  constexpr void erase(index_type Idx) {
+    --Size;
+    for (size_type I = Idx; I != Size; ++I)
+      Elems[I] = static_cast<T>(Elems[I + 1]);
+  }
+
+  /// Remove the element at Idx by moving the last element into its place.
+  constexpr void swap_remove(index_type Idx) {
+    --Size;
+    Elems[Idx] = static_cast<T>(Elems[Size]);
+  }
+
+  /// Change the size; new elements are set to Value. Returns false if Count
+  /// exceeds the capacity.
+  constexpr bool resize(size_type Count, const T &Value = T()) {
+    if (Count > N)
+      return false;
+    for (; Size < Count; ++Size)
+      Elems[Size] = Value;
+    Size = Count;
+    return true;
+  }
+
+  constexpr T *data() {
+    static_assert(!SoA, "SoA storage has no contiguous data");
+    return Elems.data();
+  }
+  constexpr const T *data() const {
+    static_assert(!SoA, "SoA storage has no contiguous data");
+    return Elems.data();
+  }
+
+private:
+  Store Elems;
+  size_type Size = 0;
+};
+
+/// A FIFO queue with storage for N elements.
+///
+/// This is not safe to share between an interrupt handler and the main
+/// program without masking interrupts around accesses.
+template <typename T, size_t N, bool SoA = false> class ring_buffer {
+  using Store = __impl::Storage<T, N, SoA>;
+
+public:
+  using value_type = T;
+  using size_type = __impl::count_t<N>;
+  using index_type = __impl::index_t<N>;
+  using reference = typename Store::reference;
+  using const_reference = typename Store::const_reference;
+  using iterator = __impl::IndexIterator<ring_buffer, reference>;
+  using const_iterator =
+      __impl::IndexIterator<const ring_buffer, const_reference>;
+
+  constexpr ring_buffer() = default;
+
+  static constexpr size_type capacity() { return N; }
+  constexpr size_type size() const { return Size; }
+  [[nodiscard]] constexpr bool empty() const { return !Size; }
+  constexpr bool full() const { return Size == N; }
+
+  /// The Idx-th element from the front.
+  constexpr reference operator[](index_type Idx) {
+    return Elems[wrap(Head + Idx)];
+  }
+  constexpr const_reference operator[](index_type Idx) const {
+    return Elems[wrap(Head + Idx)];
+  }
+  constexpr reference front() { return Elems[Head]; }
+  constexpr const_reference front() const { return Elems[Head]; }
+  constexpr reference back() { return (*this)[Size - 1]; }
+  constexpr const_reference back() const { return (*this)[Size - 1]; }
+
+  constexpr iterator begin() { return {this, 0}; }
+  constexpr iterator end() { return {this, Size}; }
+  constexpr const_iterator begin() const { return {this, 0}; }
+  constexpr const_iterator end() const { return {this, Size}; }
+
+  constexpr void clear() {
+    Head = Tail = 0;
+    Size = 0;
+  }
+
+  /// Add an element at the back; returns false if the buffer is full.
+  constexpr bool push(const T &Value) {
+    if (full())
+      return false;
+    Elems[Tail] = Value;
+    Tail = next(Tail);
+    ++Size;
+    return true;
+  }
+
+  /// Add an element at the back, dropping the front one if the buffer is full.
+  constexpr void push_overwrite(const T &Value) {
+    if (full())
+      pop();
+    push(Value);
+  }
+
+  constexpr void pop() {
+    Head = next(Head);
+    --Size;
+  }
+
+  /// Remove the front element into Value; returns false if the buffer is
+  /// empty.
+  constexpr bool try_pop(T &Value) {
+    if (empty())
+      return false;
+    Value = static_cast<T>(Elems[Head]);
+    pop();
+    return true;
+  }
+
+private:
+  // With 256 elements, an 8-bit index wraps by itself.
+  static constexpr index_type next(index_type Idx) {
+    if constexpr (N == 256)
+      return Idx + 1;
+    else
+      return Idx + 1 == N ? 0 : Idx + 1;
+  }
+  static constexpr index_type wrap(size_t Idx) {
+    if constexpr (N == 256)
+      return Idx;
+    else
+      return Idx >= N ? Idx - N : Idx;
+  }
+
+  Store Elems;
+  index_type Head = 0;
+  index_type Tail = 0;
+  size_type Size = 0;
+};
+
+/// A map with storage for N entries, kept sorted by key.
+///
+/// Keys and values are stored in separate arrays, so the binary search only
+/// touches keys. Lookups take O(log N) comparisons; insertions and erasures
+/// move the entries after the position.
+template <typename K, typename V, size_t N, bool SoA = false> class flat_map {
+  using KeyStore = __impl::Storage<K, N, SoA>;
+  using ValueStore = __impl::Storage<V, N, SoA>;
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = __impl::count_t<N>;
+  using index_type = __impl::index_t<N>;
+  using reference = typename ValueStore::reference;
+  using const_reference = typename ValueStore::const_reference;
+  using key_reference = typename KeyStore::const_reference;
+
+  constexpr flat_map() = default;
+
+  static constexpr size_type capacity() { return N; }
+  constexpr size_type size() const { return Size; }
+  [[nodiscard]] constexpr bool empty() const { return !Size; }
+  constexpr bool full() const { return Size == N; }
+  constexpr void clear() { Size = 0; }
+
+  /// The Idx-th smallest key and its value.
+  constexpr key_reference key_at(index_type Idx) const { return Keys[Idx]; }
+  constexpr reference value_at(index_type Idx) { return Values[Idx]; }
+  constexpr const_reference value_at(index_type Idx) const {
+    return Values[Idx];
+  }
+
+  /// Index of the first key not less than Key, or size() if none.
+  constexpr size_type lower_bound(const K &Key) const {
+    size_type Lo = 0;
+    size_type Hi = Size;
+    while (Lo < Hi) {
+      size_type Mid = Lo + (Hi - Lo) / 2;
+      if (static_cast<K>(Keys[Mid]) < Key)
+        Lo = Mid + 1;
+      else
+        Hi = Mid;
+    }
+    return Lo;
+  }
+
+  /// Index of Key, or size() if it is absent.
+  constexpr size_type find(const K &Key) const {
+    size_type Idx = lower_bound(Key);
+    return Idx != Size && !(Key < static_cast<K>(Keys[Idx])) ? Idx : Size;
+  }
+
+  constexpr bool contains(const K &Key) const { return find(Key) != Size; }
+
+  /// Pointer to the value for Key, or nullptr if it is absent.
+  constexpr V *get(const K &Key) {
+    static_assert(!SoA, "SoA storage has no pointers to values; use find()");
+    size_type Idx = find(Key);
+    return Idx != Size ? &Values[Idx] : nullptr;
+  }
+  constexpr const V *get(const K &Key) const {
+    static_assert(!SoA, "SoA storage has no pointers to values; use find()");
+    size_type Idx = find(Key);
+    return Idx != Size ? &Values[Idx] : nullptr;
+  }
+
+  /// Set the value for Key, adding it if absent. Returns false if it was
+  /// absent and the map is full.
+  constexpr bool insert_or_assign(const K &Key, const V &Value) {
+    size_type Idx = lower_bound(Key);
+    if (Idx == Size || Key < static_cast<K>(Keys[Idx])) {
+      if (full())
+        return false;
+      for (size_type I = Size; I != Idx; --I) {
+        Keys[I] = static_cast<K>(Keys[I - 1]);
+        Values[I] = static_cast<V>(Values[I - 1]);
+      }
+      Keys[Idx] = Key;
+      ++Size;
+    }
+    Values[Idx] = Value;
+    return true;
+  }
+
+  /// Remove Key; returns false if it was absent.
+  constexpr bool erase(const K &Key) {
+    size_type Idx = find(Key);
+    if (Idx == Size)
+      return false;
+    --Size;
+    for (size_type I = Idx; I != Size; ++I) {
+      Keys[I] = static_cast<K>(Keys[I + 1]);
+      Values[I] = static_cast<V>(Values[I + 1]);
+    }
+    return true;
+  }
+
+private:
+  KeyStore Keys;
+  ValueStore Values;
+  size_type Size = 0;
+};
+
+/// A set of N bits, packed eight to a byte.
+template <size_t N> class bitset {
+  static constexpr size_t Bytes = (N + 7) / 8;
+
+public:
+  using index_type = __impl::index_t<N>;
+  using size_type = __impl::count_t<N>;
+
+  constexpr bitset() = default;
+
+  static constexpr size_type size() { return N; }
+
+  constexpr bool test(index_type Idx) const {
+    return Bits[Idx / 8] & __impl::BitMasks[Idx % 8];
+  }
+  constexpr bool operator[](index_type Idx) const { return test(Idx); }
+
+  constexpr bitset &set(index_type Idx) {
+    Bits[Idx / 8] |= __impl::BitMasks[Idx % 8];
+    return *this;
+  }
+  constexpr bitset &set(index_type Idx, bool Value) {
+    return Value ? set(Idx) : reset(Idx);
+  }
+  constexpr bitset &reset(index_type Idx) {
+    Bits[Idx / 8] &= ~__impl::BitMasks[Idx % 8];
+    return *this;
+  }
+  constexpr bitset &flip(index_type Idx) {
+    Bits[Idx / 8] ^= __impl::BitMasks[Idx % 8];
+    return *this;
+  }
+
+  constexpr bitset &set() {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] = 0xff;
+    trim();
+    return *this;
+  }
+  constexpr bitset &reset() {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] = 0;
+    return *this;
+  }
+  constexpr bitset &flip() {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] = ~Bits[I];
+    trim();
+    return *this;
+  }
+
+  constexpr size_type count() const {
+    size_type Count = 0;
+    for (size_t I = 0; I < Bytes; ++I)
+      for (uint8_t B = Bits[I]; B; B &= B - 1)
+        ++Count;
+    return Count;
+  }
+  constexpr bool any() const {
+    for (size_t I = 0; I < Bytes; ++I)
+      if (Bits[I])
+        return true;
+    return false;
+  }
+  constexpr bool none() const { return !any(); }
+  constexpr bool all() const { return count() == N; }
+
+  /// Index of the lowest set bit, or size() if none is set.
+  constexpr size_type find_first() const {
+    for (size_t I = 0; I < Bytes; ++I) {
+      if (uint8_t B = Bits[I]) {
+        size_type Idx = I * 8;
+        for (; !(B & 1); B >>= 1)
+          ++Idx;
+        return Idx;
+      }
+    }
+    return N;
+  }
+
+  constexpr bitset &operator&=(const bitset &Other) {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] &= Other.Bits[I];
+    return *this;
+  }
+  constexpr bitset &operator|=(const bitset &Other) {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] |= Other.Bits[I];
+    return *this;
+  }
+  constexpr bitset &operator^=(const bitset &Other) {
+    for (size_t I = 0; I < Bytes; ++I)
+      Bits[I] ^= Other.Bits[I];
+    return *this;
+  }
+  constexpr bitset operator~() const { return bitset(*this).flip(); }
+  friend constexpr bitset operator&(bitset L, const bitset &R) {
+    return L &= R;
+  }
+  friend constexpr bitset operator|(bitset L, const bitset &R) {
+    return L |= R;
+  }
+  friend constexpr bitset operator^(bitset L, const bitset &R) {
+    return L ^= R;
+  }
+
+  constexpr bool operator==(const bitset &Other) const {
+    for (size_t I = 0; I < Bytes; ++I)
+      if (Bits[I] != Other.Bits[I])
+        return false;
+    return true;
+  }
+  constexpr bool operator!=(const bitset &Other) const {
+    return !(*this == Other);
+  }
+
+private:
+  // Keep the bits past N clear, so that whole-byte operations can ignore them.
+  constexpr void trim() {
+    if constexpr (N % 8 != 0)
+      Bits[Bytes - 1] &= (1 << (N % 8)) - 1;
+  }
+
+  uint8_t Bits[Bytes] = {};
+};
+
+/// A string of up to N characters, always null-terminated.
+///
+/// Appending past the capacity truncates the string and reports false.
+template <size_t N> class small_string {
+public:
+  using value_type = char;
+  using size_type = __impl::count_t<N>;
+  using index_type = __impl::index_t<N>;
+  using iterator = char *;
+  using const_iterator = const char *;
+
+  constexpr small_string() = default;
+  constexpr small_string(const char *Str) { append(Str); }
+
+  static constexpr size_type capacity() { return N; }
+  constexpr size_type size() const { return Size; }
+  constexpr size_type length() const { return Size; }
+  [[nodiscard]] constexpr bool empty() const { return !Size; }
+  constexpr bool full() const { return Size == N; }
+
+  constexpr const char *c_str() const { return Chars; }
+  constexpr const char *data() const { return Chars; }
+  constexpr char *data() { return Chars; }
+
+  constexpr char &operator[](index_type Idx) { return Chars[Idx]; }
+  constexpr const char &operator[](index_type Idx) const {
+    return Chars[Idx];
+  }
+  constexpr char &back() { return Chars[Size - 1]; }
+  constexpr const char &back() const { return Chars[Size - 1]; }
+
+  constexpr iterator begin() { return Chars; }
+  constexpr iterator end() { return Chars + Size; }
+  constexpr const_iterator begin() const { return Chars; }
+  constexpr const_iterator end() const { return Chars + Size; }
+
+  constexpr void clear() {
+    Size = 0;
+    Chars[0] = '\0';
+  }
+
+  constexpr bool push_back(char C) {
+    if (full())
+      return false;
+    Chars[Size++] = C;
+    Chars[Size] = '\0';
+    return true;
+  }
+
+  constexpr void pop_back() { Chars[--Size] = '\0'; }
+
+  /// Shorten the string to Count characters, if it is longer.
+  constexpr void truncate(size_type Count) {
+    if (Count < Size) {
+      Size = Count;
+      Chars[Size] = '\0';
+    }
+  }
+
+  constexpr bool append(const char *Str, size_t Count) {
+    bool Fits = Count <= N - Size;
+    if (!Fits)
+      Count = N - Size;
+    for (; Count; --Count)
+      Chars[Size++] = *Str++;
+    Chars[Size] = '\0';
+    return Fits;
+  }
+
+  constexpr bool append(const char *Str) {
+    for (; *Str; ++Str)
+      if (!push_back(*Str))
+        return false;
+    return true;
+  }
+
+  template <size_t M> constexpr bool append(const small_string<M> &Str) {
+    return append(Str.data(), Str.size());
+  }
+
+  constexpr bool assign(const char *Str) {
+    clear();
+    return append(Str);
+  }
+
+  constexpr small_string &operator=(const char *Str) {
+    assign(Str);
+    return *this;
+  }
+  constexpr small_string &operator+=(char C) {
+    push_back(C);
+    return *this;
+  }
+  constexpr small_string &operator+=(const char *Str) {
+    append(Str);
+    return *this;
+  }
+  template <size_t M>
+  constexpr small_string &operator+=(const small_string<M> &Str) {
+    append(Str);
+    return *this;
+  }
+
+  constexpr bool operator==(const char *Str) const {
+    for (size_type I = 0; I < Size; ++I)
+      if (Chars[I] != Str[I])
+        return false;
+    return !Str[Size];
+  }
+  constexpr bool operator!=(const char *Str) const { return !(*this == Str); }
+  template <size_t M>
+  constexpr bool operator==(const small_string<M> &Str) const {
+    return Size == Str.size() && *this == Str.c_str();
+  }
+  template <size_t M>
+  constexpr bool operator!=(const small_string<M> &Str) const {
+    return !(*this == Str);
+  }
+
+private:
+  char Chars[N + 1] = {};
+  size_type Size = 0;
+};
+
+} // namespace static_containers
+
+#endif // _STATIC_CONTAINERS_H
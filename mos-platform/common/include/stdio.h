@@ -130,10 +130,30 @@ __from_ascii(char c, void *ctx, int (*write)(char c, void *ctx));
 __attribute__((always_inline)) int __to_ascii(void *ctx,
                                               int (*read)(void *ctx));
 
+// Optional 256-entry tables holding the same mappings as __from_ascii and
+// __to_ascii, for targets where each character maps to exactly one character.
+// Bulk paths (puts, fwrite, fread, filename translation) translate whole runs
+// through them with one indexed load per character, and fall back to the
+// callbacks above where they are absent (null). Stateful or multi-character
+// encodings leave them undefined. A target defines each table in the same
+// object file as the callback it mirrors, so a program that overrides
+// __from_ascii or __to_ascii also drops the matching table from the link and
+// the bulk paths call the override instead.
+extern const char __from_ascii_table[256] __attribute__((weak));
+extern const char __to_ascii_table[256] __attribute__((weak));
+
 // Put a character in the target's character set out to the target's
 // equivalent of file descriptor 1 (stdout).
 void __putchar(char c);
 
+// Put a run of ASCII characters out to the target's equivalent of file
+// descriptor 1 (stdout), translating them as __from_ascii does. puts, fputs,
+// and fwrite write through it. Optional; the default sends each character
+// through putchar. Targets that can output blocks more cheaply may override
+// it, in which case those functions no longer reach putchar, and a program
+// that overrides putchar should override __putchars as well.
+void __putchars(const char *s, size_t n);
+
 // Get a character in the target's character set from to the target's
 // equivalent of file descriptor 0 (stdin).
 int __getchar(void);
@@ -378,6 +378,24 @@ static_assert(sizeof(struct __vera) == 32, "struct __vera must be 32 bytes");
 
 #define VERA    (*(volatile struct __vera *)0x9F20)
 
+/* VERA_CTRL values selecting a DCSEL register bank (ADDRSEL=0) */
+#define VERA_DCSEL(n)           ((unsigned char)((n) << 1))
+#define VERA_ADDRSEL            0x01
+
+/* VERA FX_CTRL bits (DCSEL = 2, display.fxctrl) */
+#define VERA_FX_TRANSPARENT     0x80
+#define VERA_FX_CACHE_WRITE     0x40
+#define VERA_FX_CACHE_FILL      0x20
+#define VERA_FX_CACHE_CYCLE     0x10
+#define VERA_FX_16BIT_HOP       0x08
+#define VERA_FX_4BIT_MODE       0x04
+
+/* VERA FX_MULT bits (DCSEL = 2, display.fxmult) */
+#define VERA_FX_RESET_ACCUM     0x80
+#define VERA_FX_ACCUMULATE      0x40
+#define VERA_FX_SUBTRACT        0x20
+#define VERA_FX_MULTIPLY        0x10
+
 /* Audio chip */
 struct __ym2151 {
     union {
@@ -600,6 +618,50 @@ void vpoke(unsigned char data, unsigned long addr) __attribute__((leaf)); // wri
 
 void waitvsync(void);  // wait for the vertical blank interrupt
 
+/* Bulk VRAM transfers. Each sets up the address once and streams through the
+** data ports; the _stride versions take a VERA_INC_* or VERA_DEC_* step, e.g.
+** VERA_INC_320 to write a column of a 320-pixel bitmap. They leave VERA_CTRL
+** at 0 and the data port addresses just past the transfer.
+*/
+void vram_copy_to(unsigned long dst, const void *src, unsigned int count);
+void vram_copy_to_stride(unsigned long dst, const void *src,
+                         unsigned int count, unsigned char incr);
+void vram_copy_from(void *dst, unsigned long src, unsigned int count);
+void vram_fill(unsigned long dst, unsigned char value, unsigned int count);
+void vram_fill_stride(unsigned long dst, unsigned char value,
+                      unsigned int count, unsigned char incr);
+/* Copy within VRAM, reading through DATA1 and writing through DATA0. */
+void vram_copy_vram2vram(unsigned long dst, unsigned long src,
+                         unsigned int count);
+
+/* VERA FX acceleration (VERA 0.3.1 and later). Each function falls back to
+** plain data port loops on older VERA versions. They use DCSEL and ADDRSEL
+** freely and leave VERA_CTRL at 0, so they must not be interleaved with other
+** VERA access (e.g. from interrupt handlers).
+*/
+unsigned char vera_fx_available(void); // non-zero if VERA FX is present
+
+/* Fill count bytes of VRAM with value; 4 bytes per store with FX. */
+void vera_fx_fill(unsigned long addr, unsigned char value, unsigned int count);
+
+/* Copy count bytes within VRAM; reads fill the FX cache, and each store
+** writes 4 bytes. Overlapping ranges are only safe if dst is below src.
+*/
+void vera_fx_copy(unsigned long dst, unsigned long src, unsigned int count);
+
+/* Signed 16x16 multiply-accumulate on the FX multiplier. The accumulator is
+** read back through 4 bytes of VRAM at scratch (4-byte aligned), which
+** vera_fx_mac_end() overwrites. No other VERA access may happen between
+** vera_fx_mac_begin() and vera_fx_mac_end().
+*/
+void vera_fx_mac_begin(unsigned long scratch); // reset the accumulator
+void vera_fx_mac(int a, int b);                // accumulator += a * b
+long vera_fx_mac_end(void);                    // return the accumulator
+
+/* Dot product of two n-element vectors, e.g. of 8.8 fixed-point values. */
+long vera_fx_dot(const int *a, const int *b, unsigned int n,
+                 unsigned long scratch);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,19 @@
+#include <__internal.h>
+#include <stdio.h>
+
+// ISO mode to ASCII, on unsigned character values. Carriage return and CURSOR
+// LEFT become newline and backspace.
+#define TO_ASCII(c) ((c) == '\r' ? '\n' : (c) == 0x9d ? '\b' : (c))
+
+// The table shares an object file with the callback it mirrors, so a program
+// that overrides __to_ascii leaves it out of the link as well.
+__attribute__((weak)) const char __to_ascii_table[256] = {
+    _CHAR_TABLE(TO_ASCII)};
+
+__attribute__((always_inline, weak)) int __to_ascii(void *ctx,
+                                                    int (*read)(void *ctx)) {
+  int c = read(ctx);
+  if (c == EOF)
+    return EOF;
+  return TO_ASCII((unsigned char)c);
+}
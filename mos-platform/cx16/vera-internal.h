@@ -0,0 +1,22 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Helpers shared by the VRAM transfer and VERA FX routines.
+
+#ifndef _VERA_INTERNAL_H
+#define _VERA_INTERNAL_H
+
+#include <cx16.h>
+
+// Points the data port chosen by sel (0 or VERA_ADDRSEL) at addr, with
+// increment incr.
+static inline void __vera_set_addr(unsigned char sel, unsigned long addr,
+                                   unsigned char incr) {
+  VERA.control = sel;
+  VERA.address = addr;
+  VERA.address_hi = (unsigned char)(addr >> 16) | incr;
+}
+
+#endif // not _VERA_INTERNAL_H
@@ -0,0 +1,156 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// VERA FX accelerated VRAM fill and copy, and the FX multiplier.
+//
+// With cache writes enabled, a store to a data port writes the 32-bit FX
+// cache to the 4-byte aligned address, using the stored byte as a nibble
+// mask (0 writes all four bytes). With cache fill also enabled, each read of
+// DATA1 loads the next cache byte. With the multiplier enabled, the cache
+// holds two signed 16-bit factors, and a cache write stores the accumulator
+// plus their product instead.
+
+#include <cx16.h>
+
+#include "vera-internal.h"
+
+static void fx_off(void) {
+  VERA.control = VERA_DCSEL(2);
+  VERA.display.fxctrl = 0;
+  VERA.display.fxmult = 0;
+  VERA.control = 0;
+}
+
+unsigned char vera_fx_available(void) {
+  static signed char available = -1;
+  if (available < 0) {
+    VERA.control = VERA_DCSEL(63);
+    unsigned char major = VERA.display.dcver1;
+    unsigned char minor = VERA.display.dcver2;
+    unsigned char build = VERA.display.dcver3;
+    available = VERA.display.dcver0 == 'V' &&
+                (major || minor > 3 || (minor == 3 && build >= 1));
+    VERA.control = 0;
+  }
+  return available;
+}
+
+void vera_fx_fill(unsigned long addr, unsigned char value, unsigned int count) {
+  if (!vera_fx_available() || count < 8) {
+    vram_fill(addr, value, count);
+    return;
+  }
+
+  __vera_set_addr(0, addr, VERA_INC_1);
+
+  // Bytes up to the next 4-byte boundary.
+  for (; addr & 3; ++addr, --count)
+    VERA.data0 = value;
+
+  VERA.control = VERA_DCSEL(6);
+  VERA.display.fxcachel = value;
+  VERA.display.fxcachem = value;
+  VERA.display.fxcacheh = value;
+  VERA.display.fxcacheu = value;
+  VERA.control = VERA_DCSEL(2);
+  VERA.display.fxmult = 0;
+  VERA.display.fxctrl = VERA_FX_CACHE_WRITE;
+  VERA.control = 0;
+  VERA.address_hi = (unsigned char)(addr >> 16) | VERA_INC_4;
+  for (unsigned int words = count >> 2; words; --words)
+    VERA.data0 = 0;
+  fx_off();
+
+  vram_fill(addr + (count & ~3u), value, count & 3);
+}
+
+void vera_fx_copy(unsigned long dst, unsigned long src, unsigned int count) {
+  if (!vera_fx_available() || count < 8) {
+    vram_copy_vram2vram(dst, src, count);
+    return;
+  }
+
+  __vera_set_addr(VERA_ADDRSEL, src, VERA_INC_1);
+  __vera_set_addr(0, dst, VERA_INC_1);
+
+  // Bytes up to the next 4-byte destination boundary. The source needs no
+  // alignment, since the cache fills a byte at a time.
+  for (; dst & 3; ++dst, --count)
+    VERA.data0 = VERA.data1;
+
+  VERA.control = VERA_DCSEL(2);
+  VERA.display.fxmult = 0; // Cache byte index 0.
+  VERA.display.fxctrl = VERA_FX_CACHE_WRITE | VERA_FX_CACHE_FILL;
+  VERA.control = 0;
+  VERA.address_hi = (unsigned char)(dst >> 16) | VERA_INC_4;
+  for (unsigned int words = count >> 2; words; --words) {
+    (void)VERA.data1;
+    (void)VERA.data1;
+    (void)VERA.data1;
+    (void)VERA.data1;
+    VERA.data0 = 0;
+  }
+  fx_off();
+
+  // DATA1 has already advanced past the copied words.
+  __vera_set_addr(0, dst + (count & ~3u), VERA_INC_1);
+  for (count &= 3; count; --count)
+    VERA.data0 = VERA.data1;
+}
+
+static unsigned long mac_scratch;
+static long mac_software;
+
+void vera_fx_mac_begin(unsigned long scratch) {
+  mac_scratch = scratch;
+  mac_software = 0;
+  if (!vera_fx_available())
+    return;
+  VERA.control = VERA_DCSEL(2);
+  VERA.display.fxctrl = VERA_FX_CACHE_WRITE;
+  VERA.display.fxmult = VERA_FX_MULTIPLY;
+  VERA.control = VERA_DCSEL(6);
+  (void)VERA.display.fxcachel; // Reading FX_ACCUM_RESET clears it.
+}
+
+void vera_fx_mac(int a, int b) {
+  if (!vera_fx_available()) {
+    mac_software += (long)a * b;
+    return;
+  }
+  // DCSEL is still 6 from vera_fx_mac_begin().
+  VERA.display.fxcachel = (unsigned char)a;
+  VERA.display.fxcachem = (unsigned char)(a >> 8);
+  VERA.display.fxcacheh = (unsigned char)b;
+  VERA.display.fxcacheu = (unsigned char)(b >> 8);
+  (void)VERA.display.fxcachem; // Reading FX_ACCUM accumulates.
+}
+
+long vera_fx_mac_end(void) {
+  if (!vera_fx_available())
+    return mac_software;
+
+  // With a zero factor, a cache write stores the bare accumulator.
+  VERA.display.fxcacheh = 0;
+  VERA.display.fxcacheu = 0;
+  __vera_set_addr(0, mac_scratch, VERA_INC_1);
+  VERA.data0 = 0;
+  fx_off();
+
+  __vera_set_addr(0, mac_scratch, VERA_INC_1);
+  unsigned long result = VERA.data0;
+  result |= (unsigned long)VERA.data0 << 8;
+  result |= (unsigned long)VERA.data0 << 16;
+  result |= (unsigned long)VERA.data0 << 24;
+  return (long)result;
+}
+
+long vera_fx_dot(const int *a, const int *b, unsigned int n,
+                 unsigned long scratch) {
+  vera_fx_mac_begin(scratch);
+  for (; n; --n)
+    vera_fx_mac(*a++, *b++);
+  return vera_fx_mac_end();
+}
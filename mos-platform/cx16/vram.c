@@ -0,0 +1,92 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Bulk VRAM transfers. The address and increment are set up once, then the
+// data port auto-increments through the rest; the loops are unrolled by eight
+// so that the per-byte cost is little more than the load and store.
+
+#include <cx16.h>
+
+#include "vera-internal.h"
+
+void vram_copy_to_stride(unsigned long dst, const void *src,
+                         unsigned int count, unsigned char incr) {
+  const unsigned char *p = src;
+  __vera_set_addr(0, dst, incr);
+  for (unsigned int n = count >> 3; n; --n, p += 8) {
+    VERA.data0 = p[0];
+    VERA.data0 = p[1];
+    VERA.data0 = p[2];
+    VERA.data0 = p[3];
+    VERA.data0 = p[4];
+    VERA.data0 = p[5];
+    VERA.data0 = p[6];
+    VERA.data0 = p[7];
+  }
+  for (count &= 7; count; --count)
+    VERA.data0 = *p++;
+}
+
+void vram_copy_to(unsigned long dst, const void *src, unsigned int count) {
+  vram_copy_to_stride(dst, src, count, VERA_INC_1);
+}
+
+void vram_copy_from(void *dst, unsigned long src, unsigned int count) {
+  unsigned char *p = dst;
+  __vera_set_addr(0, src, VERA_INC_1);
+  for (unsigned int n = count >> 3; n; --n, p += 8) {
+    p[0] = VERA.data0;
+    p[1] = VERA.data0;
+    p[2] = VERA.data0;
+    p[3] = VERA.data0;
+    p[4] = VERA.data0;
+    p[5] = VERA.data0;
+    p[6] = VERA.data0;
+    p[7] = VERA.data0;
+  }
+  for (count &= 7; count; --count)
+    *p++ = VERA.data0;
+}
+
+void vram_fill_stride(unsigned long dst, unsigned char value,
+                      unsigned int count, unsigned char incr) {
+  __vera_set_addr(0, dst, incr);
+  for (unsigned int n = count >> 3; n; --n) {
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+    VERA.data0 = value;
+  }
+  for (count &= 7; count; --count)
+    VERA.data0 = value;
+}
+
+void vram_fill(unsigned long dst, unsigned char value, unsigned int count) {
+  vram_fill_stride(dst, value, count, VERA_INC_1);
+}
+
+// DATA1 reads the source while DATA0 writes the destination, so each byte is
+// a single load and store.
+void vram_copy_vram2vram(unsigned long dst, unsigned long src,
+                         unsigned int count) {
+  __vera_set_addr(VERA_ADDRSEL, src, VERA_INC_1);
+  __vera_set_addr(0, dst, VERA_INC_1);
+  for (unsigned int n = count >> 3; n; --n) {
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+    VERA.data0 = VERA.data1;
+  }
+  for (count &= 7; count; --count)
+    VERA.data0 = VERA.data1;
+}
@@ -75,5 +75,14 @@
 #include <_suzy.h>
 #define SUZY        (*(volatile struct __suzy*)0xFC00)
 
+/* Multiply and divide run on Suzy's math unit.
+**
+** The runtime's multiply and divide libcalls share the unit's registers with
+** the rest of the program. They mask interrupts around each use of the unit,
+** and their results don't depend on SIGNMATH. A program that also drives the
+** unit directly must mask interrupts around its own sequences if any
+** interrupt handler multiplies or divides.
+*/
+
 /* End of lynx.h */
 #endif
@@ -0,0 +1,24 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Hardware replacements for common/crt/divmod-large.cc; see there for why
+// these are broken out.
+
+#include "suzy-math.h"
+
+extern "C" {
+unsigned long __udivmodsi4(unsigned long a, unsigned long b,
+                           unsigned long *rem) {
+  return suzy_udivmod(a, b, rem);
+}
+unsigned long long __udivmoddi4(unsigned long long a, unsigned long long b,
+                                unsigned long long *rem) {
+  return suzy_udivmod(a, b, rem);
+}
+long __divmodsi4(long a, long b, long *rem) { return suzy_divmod(a, b, rem); }
+long long __divmoddi4(long long a, long long b, long long *rem) {
+  return suzy_divmod(a, b, rem);
+}
+}
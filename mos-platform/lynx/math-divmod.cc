@@ -0,0 +1,68 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Hardware replacements for the division libcalls in common/crt/divmod.cc.
+// Every symbol that file defines is defined here, so it's never pulled in
+// alongside. 8-bit division stays in software, since the byte loop is about
+// as fast as loading the unit.
+
+#include "suzy-math.h"
+
+template <typename T> static inline T suzy_udiv(T a, T b) {
+  T rem;
+  return suzy_udivmod(a, b, &rem);
+}
+
+template <typename T> static inline T suzy_umod(T a, T b) {
+  T rem;
+  suzy_udivmod(a, b, &rem);
+  return rem;
+}
+
+extern "C" {
+char __udivqi3(char a, char b) { return udiv<unsigned char>(a, b); }
+unsigned __udivhi3(unsigned a, unsigned b) { return suzy_udiv(a, b); }
+unsigned long __udivsi3(unsigned long a, unsigned long b) {
+  return suzy_udiv(a, b);
+}
+unsigned long long __udivdi3(unsigned long long a, unsigned long long b) {
+  return suzy_udiv(a, b);
+}
+
+char __umodqi3(char a, char b) { return umod<unsigned char>(a, b); }
+unsigned __umodhi3(unsigned a, unsigned b) { return suzy_umod(a, b); }
+unsigned long __umodsi3(unsigned long a, unsigned long b) {
+  return suzy_umod(a, b);
+}
+unsigned long long __umoddi3(unsigned long long a, unsigned long long b) {
+  return suzy_umod(a, b);
+}
+
+char __udivmodqi4(char a, char b, char *rem) {
+  return udivmod<unsigned char>(a, b, (unsigned char *)rem);
+}
+unsigned __udivmodhi4(unsigned a, unsigned b, unsigned *rem) {
+  return suzy_udivmod(a, b, rem);
+}
+
+// The signed versions divide magnitudes with the unsigned libcalls above.
+signed char __divqi3(signed char a, signed char b) { return div(a, b); }
+int __divhi3(int a, int b) { return div(a, b); }
+long __divsi3(long a, long b) { return div(a, b); }
+long long __divdi3(long long a, long long b) { return div(a, b); }
+
+signed char __modqi3(signed char a, signed char b) { return mod(a, b); }
+int __modhi3(int a, int b) { return mod(a, b); }
+long __modsi3(long a, long b) { return mod(a, b); }
+long long __moddi3(long long a, long long b) { return mod(a, b); }
+
+signed char __divmodqi4(signed char a, signed char b, signed char *rem) {
+  return divmod(a, b, rem);
+}
+int __divmodhi4(int a, int b, int *rem) { return suzy_divmod(a, b, rem); }
+
+// si and di versions of [u]divmod are broken out into math-divmod-large.cc to
+// prevent LTO, as in common/crt.
+}
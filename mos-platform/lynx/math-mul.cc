@@ -0,0 +1,26 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Hardware replacements for the multiply libcalls in common/crt/mul.cc. Every
+// symbol that file defines is defined here, so it's never pulled in alongside.
+
+#include "suzy-math.h"
+
+extern "C" {
+
+char __mulqi3(char a, char b) {
+  return suzy_mul16_lo((unsigned char)a, (unsigned char)b);
+}
+
+unsigned __mulhi3(unsigned a, unsigned b) { return suzy_mul16_lo(a, b); }
+
+unsigned long __mulsi3(unsigned long a, unsigned long b) {
+  return suzy_mul32_lo(a, b);
+}
+
+unsigned long long __muldi3(unsigned long long a, unsigned long long b) {
+  return suzy_mul64_lo(a, b);
+}
+}
@@ -0,0 +1,191 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Multiply and divide libcalls backed by Suzy's math unit; see also lynx.h.
+//
+// Suzy multiplies AB * CD into EFGH, and divides EFGH / NP into quotient ABCD
+// and remainder JKLM. Writing the low byte of a pair clears the high byte, so
+// each pair is written low byte first. Writing A starts a multiply and
+// writing E starts a divide; SPRSYS reads back MATHWORKING until the result
+// is ready.
+//
+// SPRSYS is write only, so these routines can't know whether the program has
+// set SIGNMATH. Signed mode only changes products of operands with the top bit
+// set, so the unit is only ever handed 15-bit operands, and the top bits are
+// folded in with additions. The divider is unsigned in either mode.
+//
+// Every sequence runs with interrupts masked, so a handler that uses the unit
+// can only run between sequences, never between an operand write and the read
+// of its result.
+
+#ifndef LYNX_SUZY_MATH_H
+#define LYNX_SUZY_MATH_H
+
+#include <lynx.h>
+#include <stdint.h>
+
+#include "divmod.h"
+
+// Masks interrupts and returns the previous processor status.
+__attribute__((always_inline)) static inline uint8_t irq_save() {
+  uint8_t p;
+  __attribute__((leaf)) asm volatile("php\npla\nsei"
+                                     : "=a"(p)
+                                     :
+                                     : "p", "memory");
+  return p;
+}
+
+// Restores the processor status returned by irq_save().
+__attribute__((always_inline)) static inline void irq_restore(uint8_t p) {
+  __attribute__((leaf)) asm volatile("pha\nplp" : : "a"(p) : "p", "memory");
+}
+
+__attribute__((always_inline)) static inline void suzy_math_wait() {
+  while (SUZY.sprsys & MATHWORKING)
+    ;
+}
+
+// 15x15->30 multiply, the same in signed and unsigned mode.
+static inline uint32_t suzy_mul15(uint16_t a, uint16_t b) {
+  uint8_t p = irq_save();
+  SUZY.mathd = b;
+  SUZY.mathc = b >> 8;
+  SUZY.mathb = a;
+  SUZY.matha = a >> 8;
+  suzy_math_wait();
+  uint32_t r = (uint32_t)SUZY.mathh | (uint32_t)SUZY.mathg << 8 |
+               (uint32_t)SUZY.mathf << 16 | (uint32_t)SUZY.mathe << 24;
+  irq_restore(p);
+  return r;
+}
+
+// Low 16 bits of a 15x15 multiply.
+static inline uint16_t suzy_mul15_lo(uint16_t a, uint16_t b) {
+  uint8_t p = irq_save();
+  SUZY.mathd = b;
+  SUZY.mathc = b >> 8;
+  SUZY.mathb = a;
+  SUZY.matha = a >> 8;
+  suzy_math_wait();
+  uint16_t r = SUZY.mathh | (uint16_t)SUZY.mathg << 8;
+  irq_restore(p);
+  return r;
+}
+
+// 16x16->32 multiply. With a = 2^15 * ah + a15 and likewise for b, the top
+// bits contribute b15 << 15, a15 << 15 and 1 << 30.
+static inline uint32_t suzy_mul16(uint16_t a, uint16_t b) {
+  uint16_t a15 = a & 0x7fff, b15 = b & 0x7fff;
+  uint32_t r = suzy_mul15(a15, b15);
+  if (a & 0x8000)
+    r += (uint32_t)b15 << 15;
+  if (b & 0x8000)
+    r += (uint32_t)a15 << 15;
+  if (a & b & 0x8000)
+    r += (uint32_t)1 << 30;
+  return r;
+}
+
+// Low 16 bits of a 16x16 multiply.
+static inline uint16_t suzy_mul16_lo(uint16_t a, uint16_t b) {
+  uint16_t r = suzy_mul15_lo(a & 0x7fff, b & 0x7fff);
+  if (a & 0x8000)
+    r += b << 15;
+  if (b & 0x8000)
+    r += a << 15;
+  return r;
+}
+
+// Low 32 bits of a 32x32 multiply. Only the low halves of the cross products
+// reach the result.
+static inline uint32_t suzy_mul32_lo(uint32_t a, uint32_t b) {
+  uint16_t al = a, ah = a >> 16, bl = b, bh = b >> 16;
+  uint32_t result = suzy_mul16(al, bl);
+  if (!(ah | bh))
+    return result;
+  uint16_t mid = suzy_mul16_lo(al, bh) + suzy_mul16_lo(ah, bl);
+  return result + ((uint32_t)mid << 16);
+}
+
+// Low 64 bits of a 64x64 multiply, schoolbook over 16-bit limbs.
+static inline uint64_t suzy_mul64_lo(uint64_t a, uint64_t b) {
+  uint16_t al[4], bl[4], r[4] = {};
+  __builtin_memcpy(al, &a, sizeof(a));
+  __builtin_memcpy(bl, &b, sizeof(b));
+  for (char i = 0; i < 4; ++i) {
+    if (!bl[i])
+      continue;
+    uint16_t carry = 0;
+    for (char j = 0; i + j < 4; ++j) {
+      uint32_t p = suzy_mul16(al[j], bl[i]) + r[i + j] + carry;
+      r[i + j] = p;
+      carry = p >> 16;
+    }
+  }
+  uint64_t result;
+  __builtin_memcpy(&result, r, sizeof(result));
+  return result;
+}
+
+// 32/16 divide, with a nonzero divisor. The quotient may need all 32 bits;
+// the remainder fits in 16.
+static inline uint32_t suzy_udivmod32_16(uint32_t a, uint16_t b,
+                                         uint16_t *rem) {
+  uint8_t p = irq_save();
+  SUZY.mathp = b;
+  SUZY.mathn = b >> 8;
+  SUZY.mathh = a;
+  SUZY.mathg = a >> 8;
+  SUZY.mathf = a >> 16;
+  SUZY.mathe = a >> 24;
+  suzy_math_wait();
+  *rem = SUZY.mathm | (uint16_t)SUZY.mathl << 8;
+  uint32_t q = (uint32_t)SUZY.mathd | (uint32_t)SUZY.mathc << 8 |
+               (uint32_t)SUZY.mathb << 16 | (uint32_t)SUZY.matha << 24;
+  irq_restore(p);
+  return q;
+}
+
+static inline uint16_t suzy_udivmod(uint16_t a, uint16_t b, uint16_t *rem) {
+  if (!b || b > a) {
+    *rem = a;
+    return 0;
+  }
+  return suzy_udivmod32_16(a, b, rem);
+}
+
+// Divisors wider than 16 bits take the generic long division.
+static inline uint32_t suzy_udivmod(uint32_t a, uint32_t b, uint32_t *rem) {
+  if (b >> 16 || !b || b > a)
+    return udivmod(a, b, rem);
+  uint16_t r;
+  uint32_t q = suzy_udivmod32_16(a, b, &r);
+  *rem = r;
+  return q;
+}
+
+static inline uint64_t suzy_udivmod(uint64_t a, uint64_t b, uint64_t *rem) {
+  if (a >> 32 || b >> 16)
+    return udivmod(a, b, rem);
+  uint32_t r;
+  uint32_t q = suzy_udivmod(static_cast<uint32_t>(a), static_cast<uint32_t>(b),
+                            &r);
+  *rem = r;
+  return q;
+}
+
+template <typename T> static inline T suzy_divmod(T a, T b, T *rem) {
+  typedef typename make_unsigned<T>::type UT;
+  UT urem;
+  T uq = static_cast<T>(suzy_udivmod(safe_abs(a), safe_abs(b), &urem));
+
+  // Negating int_min here is fine, since it's only undefined behavior if the
+  // signed division itself is.
+  *rem = a < 0 ? -urem : urem;
+  return (a < 0 != b < 0) ? -uq : uq;
+}
+
+#endif // LYNX_SUZY_MATH_H
@@ -23,6 +23,15 @@ enum
   DMA_FILL_CMD = 0x03, //!< DMA fill command
 };
 
+/// Flags or'ed into the F018B command byte
+enum
+#ifdef __clang__
+    : uint8_t
+#endif
+{
+  DMA_CHAIN = 0x04, //!< Another job follows this one in the same list
+};
+
 /// Addressing modes
 enum
 #ifdef __clang__
@@ -0,0 +1,114 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// DMA-backed memcpy, memmove and memset. These replace the weak byte loops in
+// common/c/mem.c.
+//
+// The DMA controller works on physical addresses, so a job is only used where
+// the CPU and physical views agree: $0000-$CFFF is bank 0 RAM in the memory
+// map this target sets up. Anything touching I/O or ROM, or shorter than
+// DMA_MEM_THRESHOLD, where setting up the job would cost more than it saves,
+// uses the CPU.
+
+#include <mega65.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define DMA_MEM_THRESHOLD 32
+#define DMA_MEM_LIMIT 0xd000u
+
+struct dma_mem_job {
+  uint8_t enable_f018b;
+  uint8_t end_option;
+  struct DMAList_F018B list;
+};
+
+static char dma_ok(uintptr_t addr, size_t n) {
+  return addr <= DMA_MEM_LIMIT && n <= DMA_MEM_LIMIT - addr;
+}
+
+// The job lives on the soft stack, which is in bank 0. The controller's list
+// address registers are shared, so interrupts are masked from the first of
+// them to the trigger; a handler that starts its own DMA job then can't
+// redirect this one.
+static void dma_run(uint8_t command, uint16_t src, uint16_t dst, size_t n) {
+  struct dma_mem_job job;
+  job.enable_f018b = ENABLE_F018B_OPT;
+  job.end_option = 0;
+  job.list.command = command;
+  job.list.count = n;
+  job.list.source_addr = src;
+  job.list.source_bank = 0;
+  job.list.dest_addr = dst;
+  job.list.dest_bank = 0;
+  job.list.command_msb = 0;
+  job.list.modulo = 0;
+
+  // The CPU is halted until the job finishes, but the compiler must not sink
+  // the stores to job past the trigger; the memory clobber sees to that.
+  uint8_t p;
+  __attribute__((leaf)) asm volatile("php\npla\nsei"
+                                     : "=a"(p)
+                                     :
+                                     : "p", "memory");
+  DMA.enable_f018b = 1;
+  DMA.addr_bank = 0;
+  DMA.addr_msb = (uint16_t)&job >> 8;
+  DMA.trigger_enhanced = (uint16_t)&job & 0xff;
+  __attribute__((leaf)) asm volatile("pha\nplp" : : "a"(p) : "p", "memory");
+}
+
+void *memcpy(void *__restrict__ s1, const void *__restrict__ s2, size_t n) {
+  if (n >= DMA_MEM_THRESHOLD && dma_ok((uintptr_t)s1, n) &&
+      dma_ok((uintptr_t)s2, n)) {
+    dma_run(DMA_COPY_CMD, (uintptr_t)s2, (uintptr_t)s1, n);
+    return s1;
+  }
+  char *d = s1;
+  const char *s = s2;
+  for (; n; --n)
+    *d++ = *s++;
+  return s1;
+}
+
+void *memmove(void *s1, const void *s2, size_t n) {
+  uintptr_t dst = (uintptr_t)s1;
+  uintptr_t src = (uintptr_t)s2;
+
+  // A forward copy never reads a byte it has already written.
+  if (dst <= src || dst - src >= n)
+    return memcpy(s1, s2, n);
+
+  // The destination overlaps the end of the source. Copy from the end in
+  // chunks no longer than the distance between them, so that no chunk
+  // overlaps itself and each reads source bytes not yet overwritten.
+  size_t distance = dst - src;
+  if (distance >= DMA_MEM_THRESHOLD && dma_ok(src, n + distance)) {
+    while (n) {
+      size_t chunk = n < distance ? n : distance;
+      n -= chunk;
+      dma_run(DMA_COPY_CMD, src + n, dst + n, chunk);
+    }
+    return s1;
+  }
+
+  // Don't add -1 to s1 or s2; this is undefined behavior.
+  char *d = (char *)s1 + n;
+  const char *s = (const char *)s2 + n;
+  for (; n; --n)
+    *--d = *--s;
+  return s1;
+}
+
+void __memset(char *ptr, char value, size_t num) {
+  if (num >= DMA_MEM_THRESHOLD && dma_ok((uintptr_t)ptr, num)) {
+    // A fill takes its value from the low byte of the source address.
+    dma_run(DMA_FILL_CMD, (uint8_t)value, (uintptr_t)ptr, num);
+    return;
+  }
+  for (; num; ptr++, num--)
+    *ptr = value;
+}
@@ -46,9 +46,10 @@ typedef DMAJob<7, DMAList_F018B> CommonDMAJob;
  * @param count Number of values to fill
  * @param skip Optional skip (default: 1)
  */
-CommonDMAJob make_dma_fill(const uint32_t dst, const uint8_t value,
-                           const uint16_t count, const uint8_t skip = 1) {
-  CommonDMAJob dma;
+constexpr CommonDMAJob make_dma_fill(const uint32_t dst, const uint8_t value,
+                                     const uint16_t count,
+                                     const uint8_t skip = 1) {
+  CommonDMAJob dma{};
   dma.options[0] = ENABLE_F018B_OPT;
   dma.options[1] = SRC_ADDR_BITS_OPT;
   dma.options[2] = 0;
@@ -76,8 +77,8 @@ CommonDMAJob make_dma_fill(const uint32_t dst, const uint8_t value,
  * @param dst 28-bit destination address
  * @param count Number of values to copy
  */
-CommonDMAJob make_dma_copy(const uint32_t src, const uint32_t dst,
-                           const uint16_t count) {
+constexpr CommonDMAJob make_dma_copy(const uint32_t src, const uint32_t dst,
+                                     const uint16_t count) {
   auto dma = make_dma_fill(dst, 0, count);
   dma.options[2] = (uint8_t)(src >> 20);
   dma.dmalist.command = DMA_COPY_CMD;
@@ -86,6 +87,41 @@ CommonDMAJob make_dma_copy(const uint32_t src, const uint32_t dst,
   return dma;
 }
 
+/**
+ * Several fill and copy jobs that run back to back from a single trigger
+ *
+ * Every job but the last has the chain bit set, so the controller reads the
+ * next job, with its own options, straight after finishing one.
+ *
+ * @tparam N Number of jobs in the chain
+ */
+template <size_t N> struct DMAChain {
+  static_assert(N > 0);
+  CommonDMAJob jobs[N];
+};
+
+/**
+ * Create a DMA chain from fill and copy jobs, in the order given
+ *
+ * Being constexpr, a chain can be built entirely at compile time, e.g. to
+ * update screen and colour RAM in one DMA kick:
+ *
+ *     static constexpr auto clear = make_dma_chain(
+ *         make_dma_fill(0x800, ' ', 2000),
+ *         make_dma_fill(0xff80000, COLOR_WHITE, 2000));
+ *     trigger_dma(clear);
+ *
+ * @param jobs Jobs made by `make_dma_fill()` and `make_dma_copy()`
+ */
+template <typename... Jobs>
+constexpr DMAChain<sizeof...(Jobs)> make_dma_chain(const Jobs &...jobs) {
+  static_assert((std::is_same<Jobs, CommonDMAJob>::value && ...));
+  DMAChain<sizeof...(Jobs)> chain{{jobs...}};
+  for (size_t i = 0; i + 1 < sizeof...(Jobs); ++i)
+    chain.jobs[i].dmalist.command |= DMA_CHAIN;
+  return chain;
+}
+
 /**
  * Perform enhanced DMA action defined in DMAJob structure.
  */
@@ -101,5 +137,12 @@ inline void trigger_dma(const DMAJob<N, T> &dma_job) {
   asm volatile("");
 }
 
+/**
+ * Perform all jobs of a DMA chain with a single trigger.
+ */
+template <size_t N> inline void trigger_dma(const DMAChain<N> &chain) {
+  trigger_dma(chain.jobs[0]);
+}
+
 } // namespace mega65::dma
 #endif // _MEGA65_DMA_HPP
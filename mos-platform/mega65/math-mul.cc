@@ -0,0 +1,24 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Hardware replacements for the multiply libcalls in common/crt/mul.cc. Every
+// symbol that file defines is defined here, so it's never pulled in alongside.
+
+#include "math-unit.h"
+
+extern "C" {
+
+char __mulqi3(char a, char b) { return hw_mul8(a, b); }
+
+unsigned __mulhi3(unsigned a, unsigned b) { return hw_mul16(a, b); }
+
+unsigned long __mulsi3(unsigned long a, unsigned long b) {
+  return hw_mul32(a, b);
+}
+
+unsigned long long __muldi3(unsigned long long a, unsigned long long b) {
+  return hw_mul64(a, b);
+}
+}
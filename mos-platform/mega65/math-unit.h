@@ -0,0 +1,145 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Multiply and divide libcalls backed by the MEGA65 math unit ($D768-$D77F).
+//
+// The multiplier is combinatorial: MULTOUT holds the 64-bit product of
+// MULTINA and MULTINB by the time the next instruction runs. The divider
+// takes a number of 40.5 MHz cycles after each input write, during which
+// MATHBUSY bit 7 is set; DIVOUT is only read once it clears.
+//
+// The unit is shared state, so every sequence below runs with interrupts
+// masked. An interrupt handler may then multiply or divide freely: it can only
+// run between sequences, never between an input write and the read of its
+// result.
+
+#ifndef MEGA65_MATH_UNIT_H
+#define MEGA65_MATH_UNIT_H
+
+#include <mega65.h>
+
+#include "divmod.h"
+
+#define MATHBUSY_DIV 0x80
+
+// Masks interrupts and returns the previous processor status.
+__attribute__((always_inline)) static inline uint8_t irq_save() {
+  uint8_t p;
+  __attribute__((leaf)) asm volatile("php\npla\nsei"
+                                     : "=a"(p)
+                                     :
+                                     : "p", "memory");
+  return p;
+}
+
+// Restores the processor status returned by irq_save().
+__attribute__((always_inline)) static inline void irq_restore(uint8_t p) {
+  __attribute__((leaf)) asm volatile("pha\nplp" : : "a"(p) : "p", "memory");
+}
+
+// Low bits of a product depend only on the low bits of its inputs, so narrow
+// multiplies only write the bytes they need.
+__attribute__((always_inline)) static inline uint8_t hw_mul8(uint8_t a,
+                                                             uint8_t b) {
+  uint8_t p = irq_save();
+  MATH.multina8 = a;
+  MATH.multinb8 = b;
+  uint8_t r = MATH.multout8;
+  irq_restore(p);
+  return r;
+}
+
+__attribute__((always_inline)) static inline uint16_t hw_mul16(uint16_t a,
+                                                               uint16_t b) {
+  uint8_t p = irq_save();
+  MATH.multina16 = a;
+  MATH.multinb16 = b;
+  uint16_t r = MATH.multout16;
+  irq_restore(p);
+  return r;
+}
+
+__attribute__((always_inline)) static inline uint32_t hw_mul32(uint32_t a,
+                                                               uint32_t b) {
+  uint8_t p = irq_save();
+  MATH.multina32 = a;
+  MATH.multinb32 = b;
+  uint32_t r = MATH.multout32;
+  irq_restore(p);
+  return r;
+}
+
+__attribute__((always_inline)) static inline uint64_t
+hw_mul32_wide(uint32_t a, uint32_t b) {
+  uint8_t p = irq_save();
+  MATH.multina32 = a;
+  MATH.multinb32 = b;
+  uint64_t r = MATH.multout64;
+  irq_restore(p);
+  return r;
+}
+
+// Low 64 bits of a 64x64 product from up to three 32x32 hardware products.
+// Widened 32-bit operands, as in FixedPoint's 16.16 multiply, need only one.
+static inline uint64_t hw_mul64(uint64_t a, uint64_t b) {
+  uint32_t al = a, ah = a >> 32, bl = b, bh = b >> 32;
+  uint64_t r = hw_mul32_wide(al, bl);
+  if (ah | bh)
+    r += static_cast<uint64_t>(hw_mul32(al, bh) + hw_mul32(ah, bl)) << 32;
+  return r;
+}
+
+// 32/32 division. The remainder comes from the multiplier: b is still in
+// MULTINB, so loading the quotient into MULTINA yields q * b.
+static inline uint32_t hw_udivmod(uint32_t a, uint32_t b, uint32_t *rem) {
+  if (!b || b > a) {
+    *rem = a;
+    return 0;
+  }
+  uint8_t p = irq_save();
+  MATH.multina32 = a;
+  MATH.multinb32 = b;
+  while (MATHBUSY & MATHBUSY_DIV)
+    ;
+  uint32_t q = MATH.divout_whole32;
+  MATH.multina32 = q;
+  uint32_t qb = MATH.multout32;
+  irq_restore(p);
+  *rem = a - qb;
+  return q;
+}
+
+static inline uint16_t hw_udivmod(uint16_t a, uint16_t b, uint16_t *rem) {
+  uint32_t r;
+  uint16_t q =
+      hw_udivmod(static_cast<uint32_t>(a), static_cast<uint32_t>(b), &r);
+  *rem = r;
+  return q;
+}
+
+// 64-bit operands that fit in 32 bits go to the hardware; the rest take the
+// generic long division.
+static inline uint64_t hw_udivmod(uint64_t a, uint64_t b, uint64_t *rem) {
+  if ((a | b) >> 32)
+    return udivmod(a, b, rem);
+  uint32_t r;
+  uint32_t q = hw_udivmod(static_cast<uint32_t>(a), static_cast<uint32_t>(b),
+                          &r);
+  *rem = r;
+  return q;
+}
+
+template <typename T> static inline T hw_divmod(T a, T b, T *rem) {
+  typedef typename make_unsigned<T>::type UT;
+  UT urem;
+  T uq = static_cast<T>(hw_udivmod(safe_abs(a), safe_abs(b), &urem));
+
+  // Negating int_min here is fine, since it's only undefined behavior if the
+  // signed division itself is.
+  *rem = a < 0 ? -urem : urem;
+  return (a < 0 != b < 0) ? -uq : uq;
+}
+
+#endif // MEGA65_MATH_UNIT_H
@@ -0,0 +1,29 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+#include <__internal.h>
+#include <kernel.h>
+#include <stdio.h>
+
+// Neo6502 uses CR line endings instead of LF.
+#define FROM_ASCII(c) ((c) == '\n' ? '\r' : (c))
+
+// The table shares an object file with the callback it mirrors, so a program
+// that overrides __from_ascii leaves it out of the link as well.
+__attribute__((weak)) const char __from_ascii_table[256] = {
+    _CHAR_TABLE(FROM_ASCII)};
+
+__attribute__((always_inline, weak)) int
+__from_ascii(char c, void *ctx, int (*write)(char c, void *ctx)) {
+  return write(FROM_ASCII(c), ctx);
+}
+
+// Writes a run with one kernel call per character and no per-character
+// callback. It lives here so that it leaves the link along with __from_ascii
+// when a program overrides that.
+void __putchars(const char *s, size_t n) {
+  for (; n; --n)
+    KWriteCharacter(FROM_ASCII(*s++));
+}
@@ -3,22 +3,19 @@
 // See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
 // information.
 
-#include <ctype.h>
-#include <neo6502.h>
+#include <__internal.h>
+#include <stdio.h>
 
 // Neo6502 uses CR line endings instead of LF.
+#define TO_ASCII(c) ((c) == '\r' ? '\n' : (c))
 
-__attribute__((always_inline, weak)) int
-__from_ascii(char c, void *ctx, int (*write)(char c, void *ctx)) {
-  if (__builtin_expect(c == '\n', 0))
-    return write('\r', ctx);
-  return write(c, ctx);
-}
+// The table shares an object file with the callback it mirrors, so a program
+// that overrides __to_ascii leaves it out of the link as well.
+__attribute__((weak)) const char __to_ascii_table[256] = {
+    _CHAR_TABLE(TO_ASCII)};
 
 __attribute__((always_inline, weak)) int __to_ascii(void *ctx,
                                                     int (*read)(void *ctx)) {
   int c = read(ctx);
-  if (__builtin_expect(c == '\r', 0))
-    return '\n';
-  return c;
+  return TO_ASCII(c);
 }
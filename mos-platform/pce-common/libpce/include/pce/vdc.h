@@ -137,6 +137,100 @@ void pce_vdc_dma_start(uint8_t mode, uint16_t source, uint16_t dest,
  */
 bool pce_vdc_dma_finished(void);
 
+/**
+ * @brief Number of slots in the VRAM update queue; one is always kept free.
+ */
+#define PCE_VDC_QUEUE_SIZE 16
+
+/**
+ * @brief Default number of bytes the VRAM update queue uploads per frame.
+ *
+ * At about 6 cycles per byte, this is roughly 6100 cycles, or 13.5 scanlines
+ * of 455 cycles.
+ */
+#define PCE_VDC_QUEUE_DEFAULT_BUDGET 1024
+
+typedef struct {
+  /** Bytes uploaded by the last @ref pce_vdc_queue_drain call. */
+  uint16_t bytes;
+  /** Largest value of bytes since the stats were last cleared. */
+  uint16_t max_bytes;
+  /** Entries still waiting in the queue. */
+  uint8_t pending;
+  /** Drains that ran out of budget and left work for the next frame. */
+  uint8_t carried;
+  /** Enqueue calls rejected because the queue was full. */
+  uint8_t overflows;
+} vdc_queue_stats_t;
+
+/**
+ * @brief Queue a copy from RAM to VRAM for the next VBlank.
+ *
+ * Only the pointer is stored; the source must stay valid and unchanged until
+ * the copy has been drained.
+ *
+ * @param dest Destination memory address, in words.
+ * @param source Source memory address.
+ * @param length The length, in bytes. Odd lengths are rounded down.
+ * @return false if the queue is full.
+ */
+bool pce_vdc_queue_copy(uint16_t dest, const void *source, uint16_t length);
+
+/**
+ * @brief Queue a fill of VRAM with a word for the next VBlank.
+ *
+ * @param dest Destination memory address, in words.
+ * @param value The word to store.
+ * @param words The number of words.
+ * @return false if the queue is full.
+ */
+bool pce_vdc_queue_fill(uint16_t dest, uint16_t value, uint16_t words);
+
+/**
+ * @brief Queue a VRAM->SATB DMA.
+ *
+ * Once the updates queued before it have been drained, the sprite attribute
+ * table location is set, and the VDC copies it at the start of the following
+ * VBlank. Queue the sprite table upload first, then this.
+ *
+ * @param loc Location of the sprite table in VRAM, in words.
+ * @return false if the queue is full.
+ */
+bool pce_vdc_queue_satb(uint16_t loc);
+
+/**
+ * @brief Set the number of bytes uploaded per @ref pce_vdc_queue_drain call.
+ *
+ * An update that doesn't fit is split, and the rest is carried over to the
+ * next call.
+ */
+void pce_vdc_queue_set_budget(uint16_t bytes);
+
+/**
+ * @brief Perform queued VRAM updates, up to the byte budget.
+ *
+ * Call this from the VDC IRQ handler on VBlank. It uses the current VDC, sets
+ * the VRAM address and leaves the VRAM data register selected, so the main
+ * program must not be partway through a VDC register access when it runs.
+ * Copies assume the VDC is set to increment by one word.
+ */
+void pce_vdc_queue_drain(void);
+
+/**
+ * @brief Return the number of entries waiting in the VRAM update queue.
+ */
+uint8_t pce_vdc_queue_pending(void);
+
+/**
+ * @brief Read the VRAM update queue statistics.
+ */
+void pce_vdc_queue_get_stats(vdc_queue_stats_t *stats);
+
+/**
+ * @brief Reset the peak and counter fields of the queue statistics.
+ */
+void pce_vdc_queue_clear_stats(void);
+
 /**
  * @brief Set the VDC width, in tiles.
  *
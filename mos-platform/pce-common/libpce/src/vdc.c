@@ -8,6 +8,7 @@
 
 #include "pce/hardware.h"
 #include "pce/memory.h"
+#include "pce/vdc.h"
 #include <stdint.h>
 
 // The compiler should optimize away this value if it is not used.
@@ -284,4 +285,165 @@ void pce_vdc_irq_vblank_enable(void) { pce_vdc_enable(VDC_CONTROL_IRQ_VBLANK); }
 
 void pce_vdc_irq_vblank_disable(void) {
   pce_vdc_disable(VDC_CONTROL_IRQ_VBLANK);
-}
\ No newline at end of file
+}
+
+// VRAM update queue.
+//
+// Entries are added at vdc_queue_head by the main program and removed at
+// vdc_queue_tail by pce_vdc_queue_drain() in the VBlank IRQ. Each index has
+// a single writer, so no locking is needed; an entry is complete before the
+// head moves past it. The statistics are shared by both sides, so the main
+// program masks interrupts while it touches them and the byte budget.
+
+#define VDC_QUEUE_COPY 0
+#define VDC_QUEUE_FILL 1
+#define VDC_QUEUE_SATB 2
+#define VDC_QUEUE_MASK (PCE_VDC_QUEUE_SIZE - 1)
+
+typedef struct {
+  const uint8_t *source;
+  uint16_t dest;
+  uint16_t length; // In bytes.
+  uint16_t value;
+  uint8_t type;
+} vdc_queue_entry_t;
+
+static vdc_queue_entry_t vdc_queue[PCE_VDC_QUEUE_SIZE];
+static volatile uint8_t vdc_queue_head;
+static volatile uint8_t vdc_queue_tail;
+static uint16_t vdc_queue_budget = PCE_VDC_QUEUE_DEFAULT_BUDGET;
+static vdc_queue_stats_t vdc_queue_stats;
+
+// Mask interrupts, returning the previous processor status.
+__attribute__((always_inline)) static inline uint8_t vdc_queue_lock(void) {
+  uint8_t p;
+  __attribute__((leaf)) asm volatile("php\npla\nsei"
+                                     : "=a"(p)
+                                     :
+                                     : "p", "memory");
+  return p;
+}
+
+__attribute__((always_inline)) static inline void vdc_queue_unlock(uint8_t p) {
+  __attribute__((leaf)) asm volatile("pha\nplp" : : "a"(p) : "p", "memory");
+}
+
+static bool vdc_queue_push(uint8_t type, uint16_t dest, const void *source,
+                           uint16_t length, uint16_t value) {
+  uint8_t head = vdc_queue_head;
+  uint8_t next = (head + 1) & VDC_QUEUE_MASK;
+  if (next == vdc_queue_tail) {
+    uint8_t p = vdc_queue_lock();
+    vdc_queue_stats.overflows++;
+    vdc_queue_unlock(p);
+    return false;
+  }
+  vdc_queue_entry_t *e = &vdc_queue[head];
+  e->type = type;
+  e->dest = dest;
+  e->source = source;
+  e->length = length;
+  e->value = value;
+  // The drain may run as soon as the head moves; the entry must be in memory
+  // first.
+  asm volatile("" ::: "memory");
+  vdc_queue_head = next;
+  return true;
+}
+
+bool pce_vdc_queue_copy(uint16_t dest, const void *source, uint16_t length) {
+  return !length ||
+         vdc_queue_push(VDC_QUEUE_COPY, dest, source, length & ~1, 0);
+}
+
+bool pce_vdc_queue_fill(uint16_t dest, uint16_t value, uint16_t words) {
+  return !words ||
+         vdc_queue_push(VDC_QUEUE_FILL, dest, 0, words << 1, value);
+}
+
+bool pce_vdc_queue_satb(uint16_t loc) {
+  return vdc_queue_push(VDC_QUEUE_SATB, loc, 0, 0, 0);
+}
+
+void pce_vdc_queue_set_budget(uint16_t bytes) {
+  uint8_t p = vdc_queue_lock();
+  vdc_queue_budget = bytes & ~1;
+  vdc_queue_unlock(p);
+}
+
+uint8_t pce_vdc_queue_pending(void) {
+  return (vdc_queue_head - vdc_queue_tail) & VDC_QUEUE_MASK;
+}
+
+void pce_vdc_queue_get_stats(vdc_queue_stats_t *stats) {
+  uint8_t p = vdc_queue_lock();
+  *stats = vdc_queue_stats;
+  vdc_queue_unlock(p);
+  stats->pending = pce_vdc_queue_pending();
+}
+
+void pce_vdc_queue_clear_stats(void) {
+  uint8_t p = vdc_queue_lock();
+  vdc_queue_stats.max_bytes = 0;
+  vdc_queue_stats.carried = 0;
+  vdc_queue_stats.overflows = 0;
+  vdc_queue_unlock(p);
+}
+
+// Fills go through the same TIA as copies, from a run of the fill word; one
+// TIA of 32 bytes costs about as much as 12 unrolled word stores.
+static uint8_t vdc_fill_run[32];
+
+static void vdc_queue_upload(vdc_queue_entry_t *e, uint16_t n) {
+  PCE_VDC_INDEX_CONST(VDC_REG_VRAM_WRITE_ADDR);
+  *IO_VDC_DATA = e->dest;
+  PCE_VDC_INDEX_CONST(VDC_REG_VRAM_DATA);
+  if (e->type == VDC_QUEUE_COPY) {
+    pce_memop(IO_VDC_DATA, e->source, n, PCE_MEMOP_INCR_ALT);
+    e->source += n;
+  } else {
+    for (uint8_t i = 0; i < sizeof(vdc_fill_run); i += 2) {
+      vdc_fill_run[i] = e->value;
+      vdc_fill_run[i + 1] = e->value >> 8;
+    }
+    for (uint16_t left = n; left;) {
+      uint8_t chunk = left < sizeof(vdc_fill_run) ? left : sizeof(vdc_fill_run);
+      pce_memop(IO_VDC_DATA, vdc_fill_run, chunk, PCE_MEMOP_INCR_ALT);
+      left -= chunk;
+    }
+  }
+  e->dest += n >> 1;
+  e->length -= n;
+}
+
+void pce_vdc_queue_drain(void) {
+  uint16_t budget = vdc_queue_budget;
+  uint16_t left = budget;
+  uint8_t tail = vdc_queue_tail;
+  while (tail != vdc_queue_head) {
+    vdc_queue_entry_t *e = &vdc_queue[tail];
+    if (e->type == VDC_QUEUE_SATB) {
+      // The VDC copies the table to the SAT at the start of the next VBlank,
+      // after the uploads queued before this entry have landed.
+      pce_vdc_sprite_set_table_start(e->dest);
+    } else {
+      uint16_t n = e->length < left ? e->length : left;
+      if (!n)
+        break;
+      vdc_queue_upload(e, n);
+      left -= n;
+      // Out of budget partway through; the rest goes out next frame.
+      if (e->length)
+        break;
+    }
+    tail = (tail + 1) & VDC_QUEUE_MASK;
+  }
+  vdc_queue_tail = tail;
+
+  uint16_t bytes = budget - left;
+  vdc_queue_stats.bytes = bytes;
+  if (bytes > vdc_queue_stats.max_bytes)
+    vdc_queue_stats.max_bytes = bytes;
+  if (tail != vdc_queue_head)
+    vdc_queue_stats.carried++;
+}
@@ -0,0 +1,86 @@
+// Copyright 2024 LLVM-MOS Project
+// Licensed under the Apache License, Version 2.0 with LLVM Exceptions.
+// See https://github.com/llvm-mos/llvm-mos-sdk/blob/main/LICENSE for license
+// information.
+
+// Block transfer backed memcpy, memmove and memset. These replace the weak
+// byte loops in common/c/mem.c.
+//
+// pce_memop() assembles a TII or TDD in the imaginary registers and calls it,
+// at 17 cycles plus 6 per byte. A block transfer holds off interrupts until it
+// finishes, so long operations are split into PCE_MEM_CHUNK byte transfers: at
+// 7.16 MHz a scanline is 455 cycles, so a chunk delays a raster interrupt by
+// at most about seven lines. Below PCE_MEM_THRESHOLD bytes the call overhead
+// outweighs the saving and a CPU loop is used.
+
+#include <pce/memory.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PCE_MEM_THRESHOLD 8
+#define PCE_MEM_CHUNK 512
+
+void *memcpy(void *__restrict__ s1, const void *__restrict__ s2, size_t n) {
+  char *d = s1;
+  const char *s = s2;
+  if (n < PCE_MEM_THRESHOLD) {
+    for (; n; --n)
+      *d++ = *s++;
+    return s1;
+  }
+  while (n) {
+    size_t chunk = n < PCE_MEM_CHUNK ? n : PCE_MEM_CHUNK;
+    pce_memop(d, s, chunk, PCE_MEMOP_INCR_INCR);
+    d += chunk;
+    s += chunk;
+    n -= chunk;
+  }
+  return s1;
+}
+
+void *memmove(void *s1, const void *s2, size_t n) {
+  uintptr_t dst = (uintptr_t)s1;
+  uintptr_t src = (uintptr_t)s2;
+
+  // A forward copy never reads a byte it has already written.
+  if (dst <= src || dst - src >= n)
+    return memcpy(s1, s2, n);
+
+  // The destination overlaps the end of the source, so copy from the end.
+  // TDD takes the addresses of the last bytes and walks both down.
+  if (n < PCE_MEM_THRESHOLD) {
+    // Don't add -1 to s1 or s2; this is undefined behavior.
+    char *d = (char *)s1 + n;
+    const char *s = (const char *)s2 + n;
+    for (; n; --n)
+      *--d = *--s;
+    return s1;
+  }
+  while (n) {
+    size_t chunk = n < PCE_MEM_CHUNK ? n : PCE_MEM_CHUNK;
+    pce_memop((char *)s1 + n - 1, (const char *)s2 + n - 1, chunk,
+              PCE_MEMOP_DECR_DECR);
+    n -= chunk;
+  }
+  return s1;
+}
+
+void __memset(char *ptr, char value, size_t num) {
+  if (num < PCE_MEM_THRESHOLD) {
+    for (; num; ptr++, num--)
+      *ptr = value;
+    return;
+  }
+
+  // Store the first byte, then let a forward TII copy each byte to the one
+  // after it; every read picks up the value the previous step just wrote.
+  *ptr = value;
+  --num;
+  while (num) {
+    size_t chunk = num < PCE_MEM_CHUNK ? num : PCE_MEM_CHUNK;
+    pce_memop(ptr + 1, ptr, chunk, PCE_MEMOP_INCR_INCR);
+    ptr += chunk;
+    num -= chunk;
+  }
+}
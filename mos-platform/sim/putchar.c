@@ -6,3 +6,10 @@ void __putchar(char c) {
   // as a character to stdout.
   sim_reg_iface->putchar = c;
 }
+
+void __putchars(const char *s, size_t n) {
+  // The simulator uses ASCII directly, so the whole run can be streamed to the
+  // output register without translation.
+  for (; n; --n)
+    sim_reg_iface->putchar = *s++;
+}